@@ -0,0 +1,96 @@
+/**
+ * @file duplicate_filter.cpp
+ * @brief Implementação do filtro de construções repetidas
+ */
+
+#include "duplicate_filter.h"
+
+#include "../utils/random_engine.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    constexpr std::uint64_t KEY_SEED = 0x5DEECE66Dull;
+
+    // 0 marca posição vazia e BUSY posição em escrita; assinaturas com esses
+    // valores (a 0 é a da solução vazia) usam outros
+    constexpr std::uint64_t ZERO_SIGNATURE = 0x9E3779B97F4A7C15ull;
+    constexpr std::uint64_t BUSY = ~std::uint64_t{0};
+
+    std::uint64_t slotKey(std::uint64_t signature) noexcept
+    {
+        if (signature == 0)
+        {
+            return ZERO_SIGNATURE;
+        }
+        return (signature == BUSY) ? ~ZERO_SIGNATURE : signature;
+    }
+} // namespace
+
+DuplicateFilter::DuplicateFilter(int n_items, int capacity)
+    : keys_(static_cast<std::size_t>(std::max(n_items, 0))),
+      slots_(std::bit_ceil(static_cast<std::size_t>(std::max(capacity, 1)))),
+      mask_(slots_.size() - 1)
+{
+    for (std::size_t i = 0; i < keys_.size(); ++i)
+    {
+        keys_[i] = prng::splitmix64(KEY_SEED + i);
+    }
+}
+
+std::uint64_t DuplicateFilter::signature(const Solution &solution) const noexcept
+{
+    std::uint64_t hash = 0;
+    for (int item : solution.selected_items)
+    {
+        hash ^= keys_[static_cast<std::size_t>(item)];
+    }
+    return hash;
+}
+
+std::optional<int> DuplicateFilter::find(std::uint64_t signature) const noexcept
+{
+    const std::uint64_t key = slotKey(signature);
+    const Slot &slot = slots_[key & mask_];
+    if (slot.key.load(std::memory_order_acquire) != key)
+    {
+        return std::nullopt;
+    }
+    // Uma escrita concorrente troca a chave por BUSY antes de trocar o lucro:
+    // quem lê o lucro novo (acquire) também enxerga BUSY, ou a chave nova, na
+    // releitura
+    const int profit = slot.profit.load(std::memory_order_acquire);
+    if (slot.key.load(std::memory_order_relaxed) != key)
+    {
+        return std::nullopt;
+    }
+    return profit;
+}
+
+void DuplicateFilter::insert(std::uint64_t signature, int profit) noexcept
+{
+    const std::uint64_t key = slotKey(signature);
+    Slot &slot = slots_[key & mask_];
+
+    // Um escritor por vez: a posição é reservada trocando a chave observada
+    // por BUSY, e quem encontra BUSY espera a escrita em curso terminar
+    std::uint64_t observed = slot.key.load(std::memory_order_relaxed);
+    do
+    {
+        while (observed == BUSY)
+        {
+            observed = slot.key.load(std::memory_order_relaxed);
+        }
+    } while (!slot.key.compare_exchange_weak(observed, BUSY, std::memory_order_acquire,
+                                             std::memory_order_relaxed));
+
+    slot.profit.store(profit, std::memory_order_release);
+    slot.key.store(key, std::memory_order_release);
+}
+
+std::size_t DuplicateFilter::capacity() const noexcept
+{
+    return slots_.size();
+}
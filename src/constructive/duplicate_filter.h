@@ -0,0 +1,96 @@
+/**
+ * @file duplicate_filter.h
+ * @brief Filtro de construções repetidas por assinatura de solução
+ *
+ * A assinatura é um hash de Zobrist: o XOR de uma chave aleatória de 64 bits
+ * por item selecionado. Não depende da ordem de inserção dos itens e custa
+ * O(k) para k itens. As assinaturas vistas ficam numa tabela de tamanho fixo
+ * com mapeamento direto: uma assinatura nova sobrescreve a da sua posição,
+ * então a memória é limitada e o filtro pode "esquecer" soluções antigas.
+ * Cada posição guarda também o lucro final (após busca local e path
+ * relinking) da primeira ocorrência, repassado às estatísticas das
+ * repetições.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef DUPLICATE_FILTER_H
+#define DUPLICATE_FILTER_H
+
+#include "../utils/solution.h"
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @class DuplicateFilter
+ * @brief Tabela limitada de assinaturas de soluções já vistas
+ *
+ * @note Thread-safe sem mutex: quem insere reserva a posição trocando a
+ *       chave, por CAS, por um marcador de escrita antes de gravar o lucro.
+ *       Escritores da mesma posição se serializam (esperam o marcador sair)
+ *       e a chave final sempre acompanha o seu lucro. Uma busca que cruza
+ *       com uma escrita na mesma posição relê a chave e dá ausência (detecção
+ *       perdida), salvo se a posição voltar à mesma assinatura entre as duas
+ *       leituras: aí o lucro pode ser o de uma escrita intermediária. Falsos
+ *       positivos vêm só de colisões do hash de 64 bits (probabilidade ~2^-64
+ *       por par de soluções distintas).
+ */
+class DuplicateFilter
+{
+public:
+    /**
+     * @brief Construtor
+     * @param n_items Número de itens da instância (uma chave por item)
+     * @param capacity Número de posições da tabela (arredondado para potência de 2)
+     */
+    DuplicateFilter(int n_items, int capacity);
+
+    /**
+     * @brief Assinatura de Zobrist de uma solução
+     * @param solution Solução
+     * @return XOR das chaves dos itens selecionados
+     */
+    [[nodiscard]] std::uint64_t signature(const Solution &solution) const noexcept;
+
+    /**
+     * @brief Procura uma assinatura
+     * @param signature Assinatura da solução
+     * @return Lucro registrado com a assinatura, ou std::nullopt se ela não
+     *         está na tabela
+     */
+    [[nodiscard]] std::optional<int> find(std::uint64_t signature) const noexcept;
+
+    /**
+     * @brief Registra uma assinatura com o lucro final da sua solução
+     * @param signature Assinatura da solução
+     * @param profit Lucro reportado para as repetições
+     */
+    void insert(std::uint64_t signature, int profit) noexcept;
+
+    /**
+     * @brief Número de posições da tabela
+     * @return Capacidade efetiva
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+private:
+    /**
+     * @struct Slot
+     * @brief Posição da tabela: assinatura e lucro, lidos como um seqlock
+     */
+    struct Slot
+    {
+        std::atomic<std::uint64_t> key{0}; ///< Assinatura (0 = vazia; marcador reservado durante a escrita)
+        std::atomic<int> profit{0};        ///< Lucro associado à assinatura
+    };
+
+    std::vector<std::uint64_t> keys_; ///< Chave de Zobrist por item
+    std::vector<Slot> slots_;         ///< Assinaturas vistas
+    std::uint64_t mask_;              ///< capacity - 1
+};
+
+#endif // DUPLICATE_FILTER_H
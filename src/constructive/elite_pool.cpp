@@ -0,0 +1,105 @@
+/**
+ * @file elite_pool.cpp
+ * @brief Implementação do conjunto elite
+ */
+
+#include "elite_pool.h"
+
+#include <algorithm>
+#include <limits>
+
+ElitePool::ElitePool(int n_items, int capacity, int min_distance)
+    : n_items_(n_items),
+      capacity_(std::max(capacity, 1)),
+      min_distance_(std::max(min_distance, 1))
+{
+    members_.reserve(static_cast<std::size_t>(capacity_));
+}
+
+PackedBitset ElitePool::toBits(const Solution &solution) const
+{
+    PackedBitset bits(n_items_);
+    for (int item : solution.selected_items)
+    {
+        bits.set(item);
+    }
+    return bits;
+}
+
+bool ElitePool::offer(const Solution &solution)
+{
+    if (!solution.is_feasible)
+    {
+        return false;
+    }
+
+    PackedBitset bits = toBits(solution);
+
+    std::lock_guard lock(mutex_);
+
+    // Cheio e sem superar o pior membro: rejeita sem calcular distâncias
+    const bool full = members_.size() >= static_cast<std::size_t>(capacity_);
+    const auto worst = std::ranges::min_element(members_, {}, [](const Member &m)
+                                                { return m.solution.total_profit; });
+    if (full && solution.total_profit <= worst->solution.total_profit)
+    {
+        return false;
+    }
+
+    int best_profit = std::numeric_limits<int>::min();
+    int min_distance = std::numeric_limits<int>::max();
+    for (const auto &member : members_)
+    {
+        best_profit = std::max(best_profit, member.solution.total_profit);
+        min_distance = std::min(min_distance, PackedBitset::distance(bits, member.bits));
+    }
+
+    // Duplicata nunca entra; próxima demais só entra se for a nova melhor
+    if (min_distance == 0 || (min_distance < min_distance_ && solution.total_profit <= best_profit))
+    {
+        return false;
+    }
+
+    if (!full)
+    {
+        members_.push_back({solution, std::move(bits)});
+        return true;
+    }
+
+    // Substitui o membro mais parecido entre os piores que a candidata
+    Member *replaced = nullptr;
+    int replaced_distance = std::numeric_limits<int>::max();
+    for (auto &member : members_)
+    {
+        if (member.solution.total_profit >= solution.total_profit)
+        {
+            continue;
+        }
+        const int d = PackedBitset::distance(bits, member.bits);
+        if (d < replaced_distance)
+        {
+            replaced_distance = d;
+            replaced = &member;
+        }
+    }
+
+    replaced->solution = solution;
+    replaced->bits = std::move(bits);
+    return true;
+}
+
+std::optional<Solution> ElitePool::sample(std::uint32_t random) const
+{
+    std::lock_guard lock(mutex_);
+    if (members_.empty())
+    {
+        return std::nullopt;
+    }
+    return members_[random % members_.size()].solution;
+}
+
+int ElitePool::size() const
+{
+    std::lock_guard lock(mutex_);
+    return static_cast<int>(members_.size());
+}
@@ -0,0 +1,86 @@
+/**
+ * @file elite_pool.h
+ * @brief Conjunto elite de soluções de alta qualidade e diversas
+ *
+ * Mantém no máximo `capacity` soluções. Uma candidata só entra se estiver a
+ * pelo menos `min_distance` itens (distância de Hamming) de todos os membros,
+ * exceto quando supera o melhor membro; com o conjunto cheio, substitui o
+ * membro mais parecido entre os piores que ela.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef ELITE_POOL_H
+#define ELITE_POOL_H
+
+#include "../utils/packed_bitset.h"
+#include "../utils/solution.h"
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * @class ElitePool
+ * @brief Conjunto elite limitado com critério de distância mínima
+ *
+ * @note Thread-safe: todas as operações públicas tomam um mutex interno.
+ */
+class ElitePool
+{
+public:
+    /**
+     * @brief Construtor
+     * @param n_items Número de itens da instância (tamanho dos bitsets)
+     * @param capacity Número máximo de membros
+     * @param min_distance Distância de Hamming mínima para aceitar uma candidata
+     */
+    ElitePool(int n_items, int capacity, int min_distance);
+
+    /**
+     * @brief Oferece uma solução ao conjunto
+     * @param solution Solução viável
+     * @return true se a solução entrou no conjunto
+     */
+    bool offer(const Solution &solution);
+
+    /**
+     * @brief Copia um membro escolhido por um valor aleatório
+     * @param random Valor aleatório qualquer (reduzido ao número de membros)
+     * @return Cópia do membro, ou std::nullopt se o conjunto está vazio
+     */
+    [[nodiscard]] std::optional<Solution> sample(std::uint32_t random) const;
+
+    /**
+     * @brief Número atual de membros
+     * @return Tamanho do conjunto
+     */
+    [[nodiscard]] int size() const;
+
+private:
+    /**
+     * @brief Membro do conjunto elite
+     */
+    struct Member
+    {
+        Solution solution; ///< Solução
+        PackedBitset bits; ///< Itens da solução
+    };
+
+    int n_items_;                 ///< Tamanho dos bitsets
+    int capacity_;                ///< Número máximo de membros
+    int min_distance_;            ///< Distância mínima de aceitação
+    std::vector<Member> members_; ///< Membros atuais
+    mutable std::mutex mutex_;    ///< Protege members_
+
+    /**
+     * @brief Converte uma solução em bitset
+     * @param solution Solução
+     * @return Bitset com os itens selecionados
+     */
+    [[nodiscard]] PackedBitset toBits(const Solution &solution) const;
+};
+
+#endif // ELITE_POOL_H
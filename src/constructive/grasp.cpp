@@ -5,182 +5,965 @@
 
 #include "grasp.h"
 
+#include "../utils/thread_pool.h"
+
 #include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <functional>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <optional>
 #include <iomanip>
 #include <iostream>
 #include <ranges>
 #include <sstream>
+#include <type_traits>
+#include <utility>
+
+GRASPConstructive::GRASPConstructive(const DCKPInstance &inst, unsigned int seed)
+    : GRASPConstructive(inst, std::make_shared<ItemOrderCache>(inst), seed) {}
+
+GRASPConstructive::GRASPConstructive(const DCKPInstance &inst,
+                                     std::shared_ptr<ItemOrderCache> orders,
+                                     unsigned int seed) noexcept
+    : instance_(inst),
+      orders_(std::move(orders)),
+      engine_(RngEngine::XOSHIRO256),
+      rng_(makeEngine(engine_, seed)),
+      seed_(seed),
+      parallel_(false),
+      n_threads_(0),
+      ls_method_(GRASPLocalSearch::NONE),
+      ls_top_k_(0),
+      ls_max_iterations_(100),
+      ls_pivot_(PivotRule::BEST_IMPROVEMENT),
+      rcl_type_(RCLType::VALUE),
+      pr_mode_(PathRelinkingMode::NONE),
+      elite_size_(10),
+      elite_min_distance_(4),
+      duplicate_filter_enabled_(false),
+      duplicate_filter_capacity_(1 << 16) {}
+
+namespace
+{
+    /**
+     * @brief Chave de 64 bits que identifica (semente, iteração)
+     */
+    [[nodiscard]] constexpr std::uint64_t iterationKey(unsigned int seed, int iteration) noexcept
+    {
+        return (static_cast<std::uint64_t>(seed) << 32) ^ static_cast<std::uint32_t>(iteration);
+    }
+
+    /**
+     * @brief Gerador da iteração de índice iteration no modo paralelo
+     *
+     * mt19937 mantém a semente de 32 bits das versões anteriores; xoshiro256**
+     * é semeado pela chave completa; PCG32 usa a iteração como fluxo.
+     */
+    template <typename Engine>
+    [[nodiscard]] Engine iterationEngine(unsigned int seed, int iteration) noexcept
+    {
+        if constexpr (std::is_same_v<Engine, std::mt19937>)
+        {
+            const std::uint64_t mixed = prng::splitmix64(iterationKey(seed, iteration));
+            return Engine(static_cast<std::uint32_t>(mixed >> 32));
+        }
+        else if constexpr (std::is_same_v<Engine, prng::Pcg32>)
+        {
+            return Engine(seed, static_cast<std::uint32_t>(iteration));
+        }
+        else
+        {
+            return Engine(iterationKey(seed, iteration));
+        }
+    }
 
-GRASPConstructive::GRASPConstructive(const DCKPInstance &inst, unsigned int seed) noexcept
-    : instance_(inst), validator_(inst), rng_(seed) {}
+    /**
+     * @brief Segundos decorridos desde start
+     */
+    [[nodiscard]] double secondsSince(std::chrono::steady_clock::time_point start) noexcept
+    {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+} // namespace
 
-double GRASPConstructive::calculateScore(int item, const Solution &current_solution) const noexcept
+GRASPConstructive::EngineState GRASPConstructive::makeEngine(RngEngine engine, unsigned int seed) noexcept
 {
-    // Score base: razão valor/peso
-    double base_score = 0.0;
-    if (instance_.weights[item] > 0)
+    switch (engine)
     {
-        base_score = static_cast<double>(instance_.profits[item]) /
-                     static_cast<double>(instance_.weights[item]);
+    case RngEngine::PCG32:
+        return prng::Pcg32(seed);
+    case RngEngine::MT19937:
+        return std::mt19937(seed);
+    case RngEngine::XOSHIRO256:
+        break;
     }
-    else
+    return prng::Xoshiro256StarStar(seed);
+}
+
+void GRASPConstructive::prepareRanks()
+{
+    if (!rank_of_.empty() || instance_.n_items == 0)
     {
-        base_score = static_cast<double>(instance_.profits[item]) * 1000.0;
+        return;
     }
 
-    // Penalização por conflitos potenciais
-    int conflict_count = 0;
-    for (int selected : current_solution.selected_items)
+    const std::vector<int> &order = orders_->order(OrderKey::PENALIZED_RATIO);
+    const auto n = order.size();
+
+    rank_of_.resize(n);
+    rank_score_.resize(n);
+    for (std::size_t r = 0; r < n; ++r)
     {
-        if (instance_.hasConflict(item, selected))
-        {
-            ++conflict_count;
-        }
+        const int item = order[r];
+        rank_of_[static_cast<std::size_t>(item)] = static_cast<int>(r);
+        rank_score_[r] = greedy_policy::PenalizedRatio::key(instance_, item);
     }
-    conflict_count += instance_.getConflictDegree(item);
+}
 
-    const double penalty = 1.0 / (1.0 + 0.1 * conflict_count);
-    return base_score * penalty;
+void GRASPConstructive::removeCandidate(CandidateSet &set, int rank) noexcept
+{
+    auto &flag = set.alive[static_cast<std::size_t>(rank)];
+    if (flag)
+    {
+        flag = 0;
+        set.active_ranks.add(rank, -1);
+        --set.alive_count;
+    }
 }
 
-std::vector<int> GRASPConstructive::buildRCL(const Solution &current_solution, double alpha) const
+int GRASPConstructive::rclSize(double alpha, const CandidateSet &set) const noexcept
 {
-    std::vector<Candidate> candidates;
-    candidates.reserve(static_cast<std::size_t>(instance_.n_items));
+    if (rcl_type_ == RCLType::CARDINALITY)
+    {
+        const int size = 1 + static_cast<int>(alpha * (set.alive_count - 1));
+        return std::clamp(size, 1, set.alive_count);
+    }
+
+    // Threshold a partir do melhor e do pior candidato restantes
+    const int best_rank = set.active_ranks.findKth(0);
+    const int worst_rank = set.active_ranks.findKth(set.alive_count - 1);
+    const double max_score = rank_score_[static_cast<std::size_t>(best_rank)];
+    const double min_score = rank_score_[static_cast<std::size_t>(worst_rank)];
+    const double threshold = max_score - alpha * (max_score - min_score);
 
-    // Filtra candidatos viáveis
-    for (int i = 0; i < instance_.n_items; ++i)
+    // RCL = candidatos até o último rank com score >= threshold
+    const auto first = rank_score_.begin() + best_rank;
+    const auto last = rank_score_.begin() + worst_rank + 1;
+    const auto cut = std::partition_point(first, last, [threshold](double score)
+                                          { return score >= threshold; });
+    const int last_rcl_rank = static_cast<int>(cut - rank_score_.begin()) - 1;
+    return set.active_ranks.prefixSum(last_rcl_rank);
+}
+
+template <typename Engine>
+int GRASPConstructive::selectFromRCL(int rcl_size, Engine &rng)
+{
+    if constexpr (std::is_same_v<Engine, std::mt19937>)
     {
-        if (current_solution.hasItem(i))
+        std::uniform_int_distribution<int> dist(0, rcl_size - 1);
+        return dist(rng);
+    }
+    else
+    {
+        return static_cast<int>(prng::bounded(rng, static_cast<std::uint32_t>(rcl_size)));
+    }
+}
+
+template <typename Engine>
+Solution GRASPConstructive::constructSolution(double alpha, CandidateSet &set, Engine &rng) const
+{
+    const std::vector<int> &order = orders_->order(OrderKey::PENALIZED_RATIO);
+    const std::vector<int> &by_weight = orders_->order(OrderKey::MIN_WEIGHT);
+    const int n = instance_.n_items;
+
+    set.active_ranks.resetOnes(n);
+    set.alive.assign(static_cast<std::size_t>(n), 1);
+    set.alive_count = n;
+    set.heavy_pos = n - 1;
+
+    Solution solution;
+
+    while (true)
+    {
+        // Remove itens que não cabem mais (do mais pesado para o mais leve)
+        const int residual = instance_.capacity - solution.total_weight;
+        while (set.heavy_pos >= 0)
         {
-            continue;
+            const int item = by_weight[static_cast<std::size_t>(set.heavy_pos)];
+            if (instance_.weights[item] <= residual)
+            {
+                break;
+            }
+            removeCandidate(set, rank_of_[static_cast<std::size_t>(item)]);
+            --set.heavy_pos;
         }
 
-        if (!validator_.checkCapacity(current_solution.total_weight, instance_.weights[i]))
+        if (set.alive_count == 0)
         {
-            continue;
+            break;
         }
 
-        if (!validator_.checkConflicts(i, current_solution.selected_items))
+        const int rcl_size = rclSize(alpha, set);
+        const int chosen_rank = set.active_ranks.findKth(selectFromRCL(rcl_size, rng));
+        const int selected = order[static_cast<std::size_t>(chosen_rank)];
+
+        solution.addItem(selected, instance_.profits[selected], instance_.weights[selected]);
+
+        removeCandidate(set, chosen_rank);
+        for (int neighbor : instance_.conflict_graph[selected])
         {
-            continue;
+            removeCandidate(set, rank_of_[static_cast<std::size_t>(neighbor)]);
         }
+    }
+
+    // Sem conflitos por construção: os vizinhos de cada item escolhido saem
+    // do conjunto de candidatos no mesmo passo
+    solution.is_feasible = solution.total_weight <= instance_.capacity;
+    return solution;
+}
+
+GRASPConstructive::PipelineWorker::PipelineWorker(const DCKPInstance &inst) noexcept
+    : hill_climbing(inst), vnd(inst), relinker(inst) {}
+
+void GRASPConstructive::PipelineTotals::merge(const PipelineTotals &other) noexcept
+{
+    construction_time += other.construction_time;
+    local_search_time += other.local_search_time;
+    local_searches += other.local_searches;
+    local_search_improvements += other.local_search_improvements;
+    relink_time += other.relink_time;
+    relinks += other.relinks;
+    relink_improvements += other.relink_improvements;
+    signature_checks += other.signature_checks;
+    duplicates += other.duplicates;
+}
 
-        candidates.push_back({i, calculateScore(i, current_solution)});
+bool GRASPConstructive::rankedBefore(const RankedSolution &a, const RankedSolution &b) noexcept
+{
+    if (a.solution.total_profit != b.solution.total_profit)
+    {
+        return a.solution.total_profit > b.solution.total_profit;
     }
+    return a.iteration < b.iteration;
+}
 
-    if (candidates.empty())
+void GRASPConstructive::applyLocalSearch(Solution &solution, PipelineWorker &worker,
+                                         const Deadline &deadline, int iteration) const
+{
+    const auto start = std::chrono::steady_clock::now();
+    const int profit_before = solution.total_profit;
+
+    // Semente por iteração: a ordem aleatória não depende da thread
+    const std::uint64_t seed = prng::splitmix64(iterationKey(seed_, iteration));
+
+    switch (ls_method_)
     {
-        return {};
+    case GRASPLocalSearch::HILL_CLIMBING:
+        worker.hill_climbing.setPivotRule(ls_pivot_);
+        worker.hill_climbing.setSeed(seed);
+        worker.hill_climbing.improve(solution, ls_max_iterations_, deadline);
+        break;
+    case GRASPLocalSearch::VND:
+        worker.vnd.setPivotRule(ls_pivot_);
+        worker.vnd.setSeed(seed);
+        worker.vnd.improve(solution, ls_max_iterations_, deadline);
+        break;
+    case GRASPLocalSearch::NONE:
+        return;
     }
 
-    // Ordena por score decrescente
-    std::ranges::sort(candidates, std::greater<>{});
+    worker.totals.local_search_time += secondsSince(start);
+    ++worker.totals.local_searches;
+    if (solution.total_profit > profit_before)
+    {
+        ++worker.totals.local_search_improvements;
+    }
+}
 
-    // Calcula threshold da RCL
-    const double max_score = candidates.front().score;
-    const double min_score = candidates.back().score;
-    const double threshold = max_score - alpha * (max_score - min_score);
+void GRASPConstructive::relinkWithElite(Solution &solution, PipelineWorker &worker,
+                                        std::uint32_t random) const
+{
+    const auto start = std::chrono::steady_clock::now();
 
-    // Constrói RCL com candidatos acima do threshold
-    std::vector<int> rcl;
-    rcl.reserve(candidates.size());
-    for (const auto &c : candidates)
+    if (auto guide = elite_pool_->sample(random))
     {
-        if (c.score >= threshold)
+        std::optional<Solution> best;
+        if (pr_mode_ == PathRelinkingMode::FORWARD || pr_mode_ == PathRelinkingMode::BACK_AND_FORWARD)
+        {
+            best = worker.relinker.relink(solution, *guide);
+        }
+        if (pr_mode_ == PathRelinkingMode::BACKWARD || pr_mode_ == PathRelinkingMode::BACK_AND_FORWARD)
+        {
+            auto backward = worker.relinker.relink(*guide, solution);
+            if (backward && (!best || backward->total_profit > best->total_profit))
+            {
+                best = std::move(backward);
+            }
+        }
+
+        ++worker.totals.relinks;
+        if (best && best->total_profit > solution.total_profit)
         {
-            rcl.push_back(c.item_id);
+            solution = std::move(*best);
+            ++worker.totals.relink_improvements;
         }
     }
 
-    return rcl;
+    elite_pool_->offer(solution);
+    worker.totals.relink_time += secondsSince(start);
 }
 
-int GRASPConstructive::selectFromRCL(const std::vector<int> &rcl)
+void GRASPConstructive::offerElite(std::vector<RankedSolution> &elite, const Solution &solution,
+                                   int iteration) const
 {
-    if (rcl.empty())
+    RankedSolution candidate{Solution(), iteration};
+    candidate.solution.total_profit = solution.total_profit;
+
+    if (elite.size() < static_cast<std::size_t>(ls_top_k_))
     {
-        return -1;
+        candidate.solution = solution;
+        elite.push_back(std::move(candidate));
+        return;
     }
 
-    std::uniform_int_distribution<int> dist(0, static_cast<int>(rcl.size()) - 1);
-    return rcl[dist(rng_)];
+    // Pior elemento do top-k: o último na ordem rankedBefore
+    auto worst = std::ranges::max_element(elite, rankedBefore);
+    if (rankedBefore(candidate, *worst))
+    {
+        candidate.solution = solution;
+        *worst = std::move(candidate);
+    }
 }
 
-Solution GRASPConstructive::constructSolution(double alpha)
+Solution GRASPConstructive::improveElite(std::vector<RankedSolution> &elite, bool concurrent,
+                                         const Deadline &deadline, PipelineTotals &totals) const
 {
-    Solution solution;
+    std::ranges::sort(elite, rankedBefore);
+    if (elite.size() > static_cast<std::size_t>(ls_top_k_))
+    {
+        elite.resize(static_cast<std::size_t>(ls_top_k_));
+    }
 
-    while (true)
+    const unsigned int n_threads = concurrent
+                                       ? std::min(threadCount(), static_cast<unsigned int>(elite.size()))
+                                       : 1u;
+
+    std::atomic<std::size_t> next{0};
+    std::vector<PipelineTotals> worker_totals(std::max(n_threads, 1u));
+    auto work = [&](unsigned int t)
     {
-        std::vector<int> rcl = buildRCL(solution, alpha);
-        if (rcl.empty())
+        PipelineWorker worker(instance_);
+        for (std::size_t e = next++; e < elite.size(); e = next++)
         {
-            break;
+            applyLocalSearch(elite[e].solution, worker, deadline, elite[e].iteration);
         }
+        worker_totals[t] = worker.totals;
+    };
 
-        const int selected = selectFromRCL(rcl);
-        if (selected < 0)
+    if (n_threads <= 1)
+    {
+        work(0);
+    }
+    else
+    {
+        ThreadPool pool(n_threads);
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(n_threads);
+        for (unsigned int t = 0; t < n_threads; ++t)
         {
-            break;
+            tasks.push_back(pool.submit([&work, t]
+                                        { work(t); }));
         }
+        for (auto &task : tasks)
+        {
+            task.get();
+        }
+    }
 
-        solution.addItem(selected, instance_.profits[selected], instance_.weights[selected]);
+    for (const auto &worker : worker_totals)
+    {
+        totals.merge(worker);
     }
 
-    validator_.validate(solution);
-    return solution;
+    // Maior lucro após a busca; no empate, a construção mais bem ranqueada
+    Solution best;
+    best.total_profit = -1;
+    for (auto &entry : elite)
+    {
+        if (entry.solution.total_profit > best.total_profit)
+        {
+            best = std::move(entry.solution);
+        }
+    }
+    return best;
 }
 
-Solution GRASPConstructive::solve(int iterations, double alpha)
+template <typename Engine>
+Solution GRASPConstructive::runIteration(double alpha, int iteration, CandidateSet &set, Engine &rng,
+                                         PipelineWorker &worker, const Deadline &deadline, int &profit) const
 {
     const auto start = std::chrono::steady_clock::now();
+    Solution current = constructSolution(alpha, set, rng);
+    worker.totals.construction_time += secondsSince(start);
 
+    if (!current.is_feasible)
+    {
+        profit = -1;
+        return current;
+    }
+
+    const bool local_search = ls_method_ != GRASPLocalSearch::NONE;
+    std::uint64_t signature = 0;
+    if (duplicate_filter_)
+    {
+        ++worker.totals.signature_checks;
+        signature = duplicate_filter_->signature(current);
+        if (const std::optional<int> seen = duplicate_filter_->find(signature))
+        {
+            ++worker.totals.duplicates;
+            if (local_search)
+            {
+                // A primeira ocorrência já foi melhorada: as estatísticas e o
+                // alpha reativo recebem o lucro dela, não o da construção
+                profit = *seen;
+                return current;
+            }
+        }
+    }
+    if (local_search && ls_top_k_ == 0)
+    {
+        applyLocalSearch(current, worker, deadline, iteration);
+    }
+    if (pr_mode_ != PathRelinkingMode::NONE)
+    {
+        relinkWithElite(current, worker, prng::next32(rng));
+    }
+    if (local_search && ls_top_k_ > 0)
+    {
+        offerElite(worker.elite, current, iteration);
+    }
+    if (duplicate_filter_)
+    {
+        duplicate_filter_->insert(signature, current.total_profit);
+    }
+    profit = current.total_profit;
+    return current;
+}
+
+template <typename Engine>
+Solution GRASPConstructive::runSequential(int iterations, double alpha, const Deadline &deadline,
+                                          std::vector<int> &profits, Engine &rng, PipelineWorker &worker)
+{
     Solution best;
     best.total_profit = -1;
 
-    int improved_count = 0;
-    double profit_sum = 0.0;
+    for (int i = 0; i < iterations && !deadline.expired(); ++i)
+    {
+        int profit = -1;
+        Solution current = runIteration(alpha, i, candidates_, rng, worker, deadline, profit);
+        profits.push_back(profit);
+
+        if (current.is_feasible && current.total_profit > best.total_profit)
+        {
+            best = std::move(current);
+        }
+    }
 
-    for (int i = 0; i < iterations; ++i)
+    return best;
+}
+
+template <typename Engine>
+Solution GRASPConstructive::runParallel(int iterations, double alpha, ReactiveState *reactive,
+                                        const Deadline &deadline, std::vector<int> &profits,
+                                        std::vector<RankedSolution> &elite, PipelineTotals &totals) const
+{
+    struct WorkerBest
     {
-        Solution current = constructSolution(alpha);
+        Solution solution;
+        int iteration = -1;
+        std::vector<std::pair<int, int>> profits; ///< (iteração, lucro)
+        std::vector<RankedSolution> elite;        ///< Top-k da thread
+        PipelineTotals totals;                    ///< Totais da thread
+    };
+
+    const unsigned int n_threads = threadCount();
+    std::atomic<int> next_iteration{0};
+
+    std::vector<std::future<WorkerBest>> workers;
+    workers.reserve(n_threads);
+    {
+        ThreadPool pool(n_threads);
+        for (unsigned int t = 0; t < n_threads; ++t)
+        {
+            workers.push_back(pool.submit([&, this]
+                                          {
+                WorkerBest local;
+                local.solution.total_profit = -1;
+
+                CandidateSet set;
+                PipelineWorker worker(instance_);
+                std::vector<double> cumulative;
+
+                // Cada thread recebe iterações crescentes: '>' mantém a menor no empate
+                for (int i = next_iteration++; i < iterations && !deadline.expired(); i = next_iteration++)
+                {
+                    Engine rng = iterationEngine<Engine>(seed_, i);
+                    const std::size_t alpha_index = reactive ? chooseAlpha(*reactive, cumulative, rng) : 0;
+                    const double iteration_alpha = reactive ? reactive->alphas[alpha_index] : alpha;
+                    int profit = -1;
+                    Solution current = runIteration(iteration_alpha, i, set, rng, worker, deadline, profit);
+                    local.profits.emplace_back(i, profit);
+                    if (reactive)
+                    {
+                        recordAlpha(reactive->pools[alpha_index], profit);
+                    }
+
+                    if (current.is_feasible && current.total_profit > local.solution.total_profit)
+                    {
+                        local.solution = std::move(current);
+                        local.iteration = i;
+                    }
+                }
+                local.elite = std::move(worker.elite);
+                local.totals = worker.totals;
+                return local; }));
+        }
+    }
 
-        if (current.is_feasible)
+    // Redução determinística: maior lucro, menor iteração no empate
+    WorkerBest best;
+    best.solution.total_profit = -1;
+    std::vector<std::pair<int, int>> all_profits;
+    for (auto &worker : workers)
+    {
+        WorkerBest local = worker.get();
+        all_profits.insert(all_profits.end(), local.profits.begin(), local.profits.end());
+        std::ranges::move(local.elite, std::back_inserter(elite));
+        totals.merge(local.totals);
+        if (local.iteration < 0)
         {
-            profit_sum += current.total_profit;
+            continue;
+        }
+        if (local.solution.total_profit > best.solution.total_profit ||
+            (local.solution.total_profit == best.solution.total_profit && local.iteration < best.iteration))
+        {
+            best = std::move(local);
+        }
+    }
 
-            if (current.total_profit > best.total_profit)
+    std::ranges::sort(all_profits);
+    profits.reserve(all_profits.size());
+    for (const auto &entry : all_profits)
+    {
+        profits.push_back(entry.second);
+    }
+
+    return std::move(best.solution);
+}
+
+void GRASPConstructive::reactiveWeights(const ReactiveState &state, std::vector<double> &cumulative)
+{
+    const std::size_t n = state.pools.size();
+    cumulative.resize(n);
+
+    int global_best = 0;
+    for (const auto &pool : state.pools)
+    {
+        global_best = std::max(global_best, pool.best_profit.load(std::memory_order_relaxed));
+    }
+
+    double total = 0.0;
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const int uses = state.pools[k].uses.load(std::memory_order_relaxed);
+        double weight = 1.0; // Pool ainda não usado (ou sem solução viável): peso máximo
+        if (uses > 0 && global_best > 0)
+        {
+            const auto sum = state.pools[k].profit_sum.load(std::memory_order_relaxed);
+            const double average = static_cast<double>(sum) / uses;
+            weight = std::pow(average / global_best, REACTIVE_DELTA);
+        }
+        total += weight;
+        cumulative[k] = total;
+    }
+}
+
+template <typename Engine>
+std::size_t GRASPConstructive::chooseAlpha(const ReactiveState &state,
+                                           std::vector<double> &cumulative, Engine &rng)
+{
+    reactiveWeights(state, cumulative);
+
+    const double u = static_cast<double>(prng::next32(rng)) * 0x1p-32 * cumulative.back();
+    const auto it = std::ranges::upper_bound(cumulative, u);
+    return std::min(static_cast<std::size_t>(it - cumulative.begin()), cumulative.size() - 1);
+}
+
+void GRASPConstructive::recordAlpha(AlphaPool &pool, int profit) noexcept
+{
+    pool.uses.fetch_add(1, std::memory_order_relaxed);
+    pool.profit_sum.fetch_add(std::max(profit, 0), std::memory_order_relaxed);
+
+    int current = pool.best_profit.load(std::memory_order_relaxed);
+    while (profit > current &&
+           !pool.best_profit.compare_exchange_weak(current, profit, std::memory_order_relaxed))
+    {
+    }
+}
+
+void GRASPConstructive::updateStats(const std::vector<int> &profits, int iterations,
+                                    const PipelineTotals &totals)
+{
+    // Estatísticas na ordem das iterações (independe da ordem de execução)
+    int improved_count = 0;
+    long long profit_sum = 0;
+    int running_best = -1;
+    for (const int profit : profits)
+    {
+        if (profit < 0)
+        {
+            continue;
+        }
+        profit_sum += profit;
+        if (profit > running_best)
+        {
+            running_best = profit;
+            ++improved_count;
+        }
+    }
+
+    const int completed = static_cast<int>(profits.size());
+    stats_.iterations = completed;
+    stats_.improvements = improved_count;
+    stats_.average_profit = (completed > 0) ? static_cast<double>(profit_sum) / completed : 0.0;
+    stats_.time_limit_reached = completed < iterations;
+    stats_.alpha_pools.clear();
+    stats_.construction_time = totals.construction_time;
+    stats_.local_search_time = totals.local_search_time;
+    stats_.local_searches = totals.local_searches;
+    stats_.local_search_improvements = totals.local_search_improvements;
+    stats_.relink_time = totals.relink_time;
+    stats_.relinks = totals.relinks;
+    stats_.relink_improvements = totals.relink_improvements;
+    stats_.elite_size = elite_pool_ ? elite_pool_->size() : 0;
+    stats_.signature_checks = totals.signature_checks;
+    stats_.duplicates = totals.duplicates;
+}
+
+void GRASPConstructive::printSummary(const Solution &best, std::string_view header) const
+{
+    std::cout << header << ": "
+              << "Valor = " << best.total_profit
+              << ", Media = " << std::fixed << std::setprecision(1) << stats_.average_profit
+              << ", Melhorias = " << stats_.improvements;
+    if (parallel_)
+    {
+        std::cout << ", Threads = " << threadCount();
+    }
+    std::cout << ", Tempo = " << std::setprecision(4) << best.computation_time << "s";
+    if (ls_method_ != GRASPLocalSearch::NONE)
+    {
+        std::cout << " [Construcao = " << stats_.construction_time << "s"
+                  << ", Busca Local = " << stats_.local_search_time << "s"
+                  << ", Buscas = " << stats_.local_searches
+                  << ", Melhoradas = " << stats_.local_search_improvements;
+        if (ls_pivot_ != PivotRule::BEST_IMPROVEMENT)
+        {
+            std::cout << ", Regra = " << MoveEngine::pivotRuleToString(ls_pivot_);
+        }
+        std::cout << ']';
+    }
+    if (pr_mode_ != PathRelinkingMode::NONE)
+    {
+        std::cout << " [PR " << PathRelinking::modeToString(pr_mode_)
+                  << ": Relinks = " << stats_.relinks
+                  << ", Melhorias = " << stats_.relink_improvements
+                  << ", Elite = " << stats_.elite_size
+                  << ", Tempo = " << stats_.relink_time << "s]";
+    }
+    if (duplicate_filter_)
+    {
+        const double hit_rate = (stats_.signature_checks > 0)
+                                    ? 100.0 * stats_.duplicates / stats_.signature_checks
+                                    : 0.0;
+        std::cout << " [Duplicatas = " << stats_.duplicates << '/' << stats_.signature_checks
+                  << " (" << std::setprecision(1) << hit_rate << "%)]";
+    }
+    if (stats_.time_limit_reached)
+    {
+        std::cout << " [limite de tempo]";
+    }
+    std::cout << '\n';
+}
+
+Solution GRASPConstructive::solve(int iterations, double alpha, const Deadline &deadline)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    prepareRanks();
+    resetElitePool();
+    resetDuplicateFilter();
+
+    std::vector<int> profits;
+    if (deadline.unlimited())
+    {
+        profits.reserve(static_cast<std::size_t>(std::max(iterations, 0)));
+    }
+    std::vector<RankedSolution> elite;
+    PipelineTotals totals;
+    Solution best = std::visit(
+        [&](auto &rng)
+        {
+            using Engine = std::decay_t<decltype(rng)>;
+            if (parallel_)
             {
-                best = std::move(current);
-                ++improved_count;
+                return runParallel<Engine>(iterations, alpha, nullptr, deadline, profits, elite, totals);
             }
+            PipelineWorker worker(instance_);
+            Solution result = runSequential(iterations, alpha, deadline, profits, rng, worker);
+            elite = std::move(worker.elite);
+            totals = worker.totals;
+            return result;
+        },
+        rng_);
+
+    if (ls_method_ != GRASPLocalSearch::NONE && ls_top_k_ > 0)
+    {
+        Solution improved = improveElite(elite, parallel_, deadline, totals);
+        if (improved.total_profit >= best.total_profit)
+        {
+            best = std::move(improved);
         }
     }
 
-    const auto end = std::chrono::steady_clock::now();
-    const std::chrono::duration<double> elapsed = end - start;
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    best.computation_time = elapsed.count();
+
+    updateStats(profits, iterations, totals);
+
+    std::ostringstream name;
+    name << "GRASP_" << stats_.iterations << '_' << std::fixed << std::setprecision(1) << alpha;
+    if (rcl_type_ == RCLType::CARDINALITY)
+    {
+        name << "_Card";
+    }
+    if (ls_method_ != GRASPLocalSearch::NONE)
+    {
+        name << '+' << localSearchToString(ls_method_);
+    }
+    if (pr_mode_ != PathRelinkingMode::NONE)
+    {
+        name << "+PR";
+    }
+    best.method_name = name.str();
+
+    std::ostringstream header;
+    header << "GRASP";
+    if (ls_method_ != GRASPLocalSearch::NONE)
+    {
+        header << '+' << localSearchToString(ls_method_);
+    }
+    if (pr_mode_ != PathRelinkingMode::NONE)
+    {
+        header << "+PR";
+    }
+    header << " (iter=" << stats_.iterations << ", alpha=" << alpha;
+    if (rcl_type_ == RCLType::CARDINALITY)
+    {
+        header << ", rcl=Cardinality";
+    }
+    header << ')';
+    printSummary(best, header.str());
 
+    return best;
+}
+
+Solution GRASPConstructive::solveReactive(int iterations, std::span<const double> alphas,
+                                          const Deadline &deadline)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    prepareRanks();
+    resetElitePool();
+    resetDuplicateFilter();
+
+    ReactiveState state{alphas, std::vector<AlphaPool>(alphas.size())};
+
+    std::vector<int> profits;
+    std::vector<RankedSolution> elite;
+    PipelineTotals totals;
+    Solution best;
+    best.total_profit = -1;
+    if (!alphas.empty())
+    {
+        best = std::visit(
+            [&](auto &rng)
+            {
+                using Engine = std::decay_t<decltype(rng)>;
+                return runParallel<Engine>(iterations, 0.0, &state, deadline, profits, elite, totals);
+            },
+            rng_);
+    }
+
+    if (ls_method_ != GRASPLocalSearch::NONE && ls_top_k_ > 0)
+    {
+        Solution improved = improveElite(elite, parallel_, deadline, totals);
+        if (improved.total_profit >= best.total_profit)
+        {
+            best = std::move(improved);
+        }
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
     best.computation_time = elapsed.count();
 
+    updateStats(profits, iterations, totals);
+
+    std::vector<double> cumulative;
+    if (!alphas.empty())
+    {
+        reactiveWeights(state, cumulative);
+    }
+    double previous = 0.0;
+    for (std::size_t k = 0; k < alphas.size(); ++k)
+    {
+        const AlphaPool &pool = state.pools[k];
+        AlphaPoolStats entry;
+        entry.alpha = alphas[k];
+        entry.probability = (cumulative[k] - previous) / cumulative.back();
+        entry.uses = pool.uses.load();
+        entry.average_profit = (entry.uses > 0)
+                                   ? static_cast<double>(pool.profit_sum.load()) / entry.uses
+                                   : 0.0;
+        entry.best_profit = pool.best_profit.load();
+        stats_.alpha_pools.push_back(entry);
+        previous = cumulative[k];
+    }
+
     std::ostringstream name;
-    name << "GRASP_" << iterations << '_' << std::fixed << std::setprecision(1) << alpha;
+    name << "GRASP_Reactive_" << stats_.iterations;
+    if (ls_method_ != GRASPLocalSearch::NONE)
+    {
+        name << '+' << localSearchToString(ls_method_);
+    }
+    if (pr_mode_ != PathRelinkingMode::NONE)
+    {
+        name << "+PR";
+    }
     best.method_name = name.str();
 
-    const double avg = (iterations > 0) ? profit_sum / iterations : 0.0;
+    std::ostringstream header;
+    header << "GRASP Reativo (iter=" << stats_.iterations << ", alphas=" << alphas.size() << ')';
+    printSummary(best, header.str());
 
-    std::cout << "GRASP (iter=" << iterations << ", alpha=" << alpha << "): "
-              << "Valor = " << best.total_profit
-              << ", Media = " << std::fixed << std::setprecision(1) << avg
-              << ", Melhorias = " << improved_count
-              << ", Tempo = " << std::setprecision(4) << best.computation_time << "s\n";
+    for (const auto &entry : stats_.alpha_pools)
+    {
+        std::cout << "  alpha = " << std::setprecision(2) << entry.alpha
+                  << ": Prob = " << std::setprecision(3) << entry.probability
+                  << ", Usos = " << entry.uses
+                  << ", Media = " << std::setprecision(1) << entry.average_profit
+                  << ", Melhor = " << entry.best_profit << '\n';
+    }
 
     return best;
 }
 
 void GRASPConstructive::setSeed(unsigned int seed) noexcept
 {
-    rng_.seed(seed);
+    rng_ = makeEngine(engine_, seed);
+    seed_ = seed;
+}
+
+void GRASPConstructive::setRngEngine(RngEngine engine) noexcept
+{
+    engine_ = engine;
+    rng_ = makeEngine(engine_, seed_);
+}
+
+RngEngine GRASPConstructive::rngEngine() const noexcept
+{
+    return engine_;
+}
+
+const GRASPStats &GRASPConstructive::lastStats() const noexcept
+{
+    return stats_;
+}
+
+void GRASPConstructive::setParallel(bool enabled, unsigned int n_threads) noexcept
+{
+    parallel_ = enabled;
+    n_threads_ = n_threads;
+}
+
+unsigned int GRASPConstructive::threadCount() const noexcept
+{
+    if (!parallel_)
+    {
+        return 1;
+    }
+    return (n_threads_ == 0) ? ThreadPool::defaultThreadCount() : n_threads_;
+}
+
+void GRASPConstructive::setLocalSearch(GRASPLocalSearch method, int top_k, int max_iterations,
+                                       PivotRule pivot) noexcept
+{
+    ls_method_ = method;
+    ls_top_k_ = std::max(top_k, 0);
+    ls_max_iterations_ = max_iterations;
+    ls_pivot_ = pivot;
+}
+
+std::string_view GRASPConstructive::localSearchToString(GRASPLocalSearch method) noexcept
+{
+    switch (method)
+    {
+    case GRASPLocalSearch::NONE:
+        return "None";
+    case GRASPLocalSearch::HILL_CLIMBING:
+        return "HC";
+    case GRASPLocalSearch::VND:
+        return "VND";
+    }
+    return "Unknown";
+}
+
+void GRASPConstructive::setRCLType(RCLType type) noexcept
+{
+    rcl_type_ = type;
+}
+
+void GRASPConstructive::setPathRelinking(PathRelinkingMode mode, int elite_size, int min_distance) noexcept
+{
+    pr_mode_ = mode;
+    elite_size_ = elite_size;
+    elite_min_distance_ = min_distance;
+}
+
+void GRASPConstructive::setDuplicateFilter(bool enabled, int capacity) noexcept
+{
+    duplicate_filter_enabled_ = enabled;
+    duplicate_filter_capacity_ = capacity;
+}
+
+void GRASPConstructive::resetElitePool()
+{
+    elite_pool_.reset();
+    if (pr_mode_ != PathRelinkingMode::NONE)
+    {
+        elite_pool_ = std::make_unique<ElitePool>(instance_.n_items, elite_size_, elite_min_distance_);
+    }
+}
+
+void GRASPConstructive::resetDuplicateFilter()
+{
+    duplicate_filter_.reset();
+    if (duplicate_filter_enabled_)
+    {
+        duplicate_filter_ = std::make_unique<DuplicateFilter>(instance_.n_items, duplicate_filter_capacity_);
+    }
 }
@@ -12,13 +12,83 @@
 #ifndef GRASP_H
 #define GRASP_H
 
+#include "../local_search/hill_climbing.h"
+#include "../local_search/vnd.h"
+#include "../utils/deadline.h"
+#include "../utils/fenwick_tree.h"
 #include "../utils/instance_reader.h"
+#include "../utils/random_engine.h"
 #include "../utils/solution.h"
-#include "../utils/validator.h"
+#include "duplicate_filter.h"
+#include "elite_pool.h"
+#include "item_order_cache.h"
+#include "path_relinking.h"
 
+#include <atomic>
+#include <memory>
 #include <random>
+#include <span>
+#include <string_view>
+#include <variant>
 #include <vector>
 
+/**
+ * @enum GRASPLocalSearch
+ * @brief Busca local aplicada às construções do GRASP
+ */
+enum class GRASPLocalSearch
+{
+    NONE,          ///< Apenas fase construtiva
+    HILL_CLIMBING, ///< HillClimbing (Swap 1-1)
+    VND            ///< VND (Add/Drop, Swap 1-1, Swap 2-1)
+};
+
+/**
+ * @enum RCLType
+ * @brief Critério de formação da Lista Restrita de Candidatos
+ */
+enum class RCLType
+{
+    VALUE,      ///< score >= max - alpha * (max - min)
+    CARDINALITY ///< Os 1 + floor(alpha * (candidatos - 1)) melhores candidatos
+};
+
+/**
+ * @struct AlphaPoolStats
+ * @brief Resultado de um valor de alpha no GRASP reativo
+ */
+struct AlphaPoolStats
+{
+    double alpha = 0.0;          ///< Valor de alpha
+    double probability = 0.0;    ///< Probabilidade final de seleção
+    int uses = 0;                ///< Construções feitas com este alpha
+    double average_profit = 0.0; ///< Lucro médio das construções
+    int best_profit = -1;        ///< Melhor lucro obtido
+};
+
+/**
+ * @struct GRASPStats
+ * @brief Estatísticas da última execução de GRASPConstructive::solve
+ */
+struct GRASPStats
+{
+    int iterations = 0;              ///< Iterações (construções) concluídas
+    int improvements = 0;            ///< Vezes em que a melhor solução melhorou
+    double average_profit = 0.0;     ///< Lucro médio por iteração concluída
+    bool time_limit_reached = false; ///< Parou pelo Deadline
+    std::vector<AlphaPoolStats> alpha_pools; ///< Distribuição final dos alphas (apenas solveReactive)
+    double construction_time = 0.0;          ///< Tempo de construção somado entre threads
+    double local_search_time = 0.0;          ///< Tempo de busca local somado entre threads
+    int local_searches = 0;                  ///< Buscas locais executadas
+    int local_search_improvements = 0;       ///< Buscas locais que melhoraram a construção
+    double relink_time = 0.0;                ///< Tempo de path relinking somado entre threads
+    int relinks = 0;                         ///< Construções submetidas ao path relinking
+    int relink_improvements = 0;             ///< Path relinkings que melhoraram a construção
+    int elite_size = 0;                      ///< Membros do conjunto elite ao final
+    int signature_checks = 0;                ///< Construções consultadas no filtro de duplicatas
+    int duplicates = 0;                      ///< Construções já vistas (busca local evitada)
+};
+
 /**
  * @class GRASPConstructive
  * @brief Implementa a fase construtiva do GRASP
@@ -26,7 +96,11 @@
  * Constrói soluções usando aleatoriedade controlada através de uma
  * Lista Restrita de Candidatos (RCL), permitindo maior diversificação.
  *
- * @note Usa Mersenne Twister (std::mt19937) para geração de números aleatórios.
+ * @note Usa xoshiro256** por padrão (ver setRngEngine); RngEngine::MT19937
+ *       reproduz os resultados das versões baseadas em std::mt19937.
+ *       No modo paralelo cada iteração usa um fluxo próprio derivado de
+ *       (semente, índice da iteração), de modo que o resultado para uma
+ *       semente não depende do número de threads.
  */
 class GRASPConstructive
 {
@@ -36,17 +110,59 @@ public:
      * @param inst Referência para a instância do problema
      * @param seed Semente para o gerador aleatório (default: 42)
      */
-    explicit GRASPConstructive(const DCKPInstance &inst, unsigned int seed = 42) noexcept;
+    explicit GRASPConstructive(const DCKPInstance &inst, unsigned int seed = 42);
+
+    /**
+     * @brief Construtor com cache de ordenações compartilhado
+     * @param inst Referência para a instância do problema
+     * @param orders Cache de ordenações da mesma instância (ex.: também usado pelo Guloso)
+     * @param seed Semente para o gerador aleatório (default: 42)
+     */
+    GRASPConstructive(const DCKPInstance &inst,
+                      std::shared_ptr<ItemOrderCache> orders,
+                      unsigned int seed = 42) noexcept;
 
     /**
      * @brief Executa múltiplas iterações do GRASP
-     * @param iterations Número de iterações (default: 100)
+     * @param iterations Número máximo de iterações (default: 100)
      * @param alpha Parâmetro de controle da aleatoriedade [0, 1] (default: 0.3)
+     * @param deadline Limite de tempo; consultado antes de cada construção
      * @return Melhor solução encontrada
      *
      * @note alpha=0 → guloso puro; alpha=1 → totalmente aleatório
+     * @note Com deadline no modo paralelo, o conjunto de iterações concluídas
+     *       depende do escalonamento e o resultado deixa de ser determinístico.
+     */
+    [[nodiscard]] Solution solve(int iterations = 100, double alpha = 0.3,
+                                 const Deadline &deadline = Deadline());
+
+    /**
+     * @brief Executa o GRASP reativo sobre um conjunto de valores de alpha
+     *
+     * Cada alpha tem um pool de estatísticas (usos, soma e melhor lucro)
+     * compartilhado entre as threads por variáveis atômicas. A cada iteração
+     * o alpha é sorteado com probabilidade proporcional a
+     * (média do pool / melhor lucro global)^REACTIVE_DELTA; pools ainda não
+     * usados recebem peso máximo. As iterações rodam sempre no ThreadPool,
+     * com o número de threads definido em setParallel (uma só thread com o
+     * modo paralelo desativado).
+     *
+     * @param iterations Número máximo de iterações
+     * @param alphas Valores candidatos de alpha em [0, 1] (não vazio)
+     * @param deadline Limite de tempo; consultado antes de cada construção
+     * @return Melhor solução encontrada
+     *
+     * @note Com uma thread o resultado é determinístico para a semente; com
+     *       mais threads as probabilidades dependem da ordem de conclusão.
+     */
+    [[nodiscard]] Solution solveReactive(int iterations, std::span<const double> alphas,
+                                         const Deadline &deadline = Deadline());
+
+    /**
+     * @brief Estatísticas da última chamada de solve() ou solveReactive()
+     * @return Estatísticas (iterações concluídas, melhorias, média)
      */
-    [[nodiscard]] Solution solve(int iterations = 100, double alpha = 0.3);
+    [[nodiscard]] const GRASPStats &lastStats() const noexcept;
 
     /**
      * @brief Define nova semente para o gerador aleatório
@@ -54,54 +170,425 @@ public:
      */
     void setSeed(unsigned int seed) noexcept;
 
+    /**
+     * @brief Escolhe o gerador aleatório das construções
+     *
+     * O fluxo sequencial é reiniciado a partir da semente atual.
+     *
+     * @param engine Gerador (default: RngEngine::XOSHIRO256)
+     */
+    void setRngEngine(RngEngine engine) noexcept;
+
+    /**
+     * @brief Gerador aleatório em uso
+     * @return Gerador configurado
+     */
+    [[nodiscard]] RngEngine rngEngine() const noexcept;
+
+    /**
+     * @brief Ativa ou desativa o modo paralelo
+     *
+     * No modo paralelo as iterações são distribuídas entre threads de um
+     * ThreadPool. A iteração i usa um gerador semeado a partir de (semente, i)
+     * e o melhor resultado é escolhido por maior lucro, com empate pela menor
+     * iteração: o resultado é idêntico para qualquer número de threads.
+     * O modo sequencial (default) mantém o fluxo único de rng_.
+     *
+     * @param enabled true para executar em paralelo
+     * @param n_threads Número de threads (0 → ThreadPool::defaultThreadCount())
+     */
+    void setParallel(bool enabled, unsigned int n_threads = 0) noexcept;
+
+    /**
+     * @brief Configura a busca local aplicada às construções
+     *
+     * Com top_k = 0 a busca roda sobre toda construção viável, dentro da
+     * própria iteração (o lucro registrado é o melhorado). Com top_k > 0 as k
+     * melhores construções (maior lucro, menor iteração no empate) são
+     * guardadas e melhoradas ao fim da fase construtiva. Cada thread mantém
+     * seu próprio HillClimbing/VND, cujos buffers são reaproveitados entre
+     * iterações.
+     *
+     * @param method Busca local (GRASPLocalSearch::NONE desativa)
+     * @param top_k Número de construções melhoradas (0 = todas)
+     * @param max_iterations Iterações máximas de cada busca local
+     * @param pivot Regra de escolha do movimento; em SHUFFLED_FIRST_IMPROVEMENT
+     *        a ordem é sorteada a partir da semente e da iteração
+     */
+    void setLocalSearch(GRASPLocalSearch method, int top_k = 0, int max_iterations = 100,
+                        PivotRule pivot = PivotRule::BEST_IMPROVEMENT) noexcept;
+
+    /**
+     * @brief Define o critério da RCL (default: RCLType::VALUE)
+     *
+     * Os candidatos já estão em ordem de score, logo nenhum dos critérios
+     * precisa ordenar ou filtrar: o tamanho da RCL vem de uma busca binária
+     * (VALUE) ou diretamente do número de candidatos (CARDINALITY), e o
+     * sorteio escolhe o k-ésimo candidato vivo na Fenwick tree.
+     *
+     * @param type Critério da RCL
+     */
+    void setRCLType(RCLType type) noexcept;
+
+    /**
+     * @brief Configura o path relinking com conjunto elite
+     *
+     * Cada construção (já melhorada pela busca local, se top_k = 0) é ligada
+     * a um membro elite sorteado; a melhor solução intermediária substitui a
+     * construção se for melhor. Em seguida a solução é oferecida ao conjunto
+     * elite (distância mínima de Hamming, ver ElitePool). O conjunto é
+     * recriado a cada solve() e compartilhado entre as threads.
+     *
+     * @param mode Direção (PathRelinkingMode::NONE desativa)
+     * @param elite_size Número máximo de membros elite
+     * @param min_distance Distância mínima para um membro novo
+     * @note Com mais de uma thread o conteúdo do conjunto elite depende da
+     *       ordem de conclusão das iterações.
+     */
+    void setPathRelinking(PathRelinkingMode mode, int elite_size = 10, int min_distance = 4) noexcept;
+
+    /**
+     * @brief Ativa o filtro de construções repetidas
+     *
+     * Cada construção viável é identificada pela sua assinatura de Zobrist.
+     * Com busca local configurada, uma construção já vista não passa pela
+     * busca local nem pelo path relinking (o resultado seria o mesmo da
+     * primeira vez) e conta, nas médias e no alpha reativo, com o lucro final
+     * da primeira ocorrência; sem busca local o filtro apenas mede a taxa de
+     * repetição.
+     *
+     * @param enabled true para ativar
+     * @param capacity Posições da tabela de assinaturas (16 bytes cada)
+     */
+    void setDuplicateFilter(bool enabled, int capacity = 1 << 16) noexcept;
+
+    /**
+     * @brief Converte GRASPLocalSearch para string
+     * @param method Busca local
+     * @return Nome curto ("None", "HC", "VND")
+     */
+    [[nodiscard]] static std::string_view localSearchToString(GRASPLocalSearch method) noexcept;
+
 private:
-    const DCKPInstance &instance_; ///< Referência para a instância
-    Validator validator_;          ///< Validador de soluções
-    std::mt19937 rng_;             ///< Gerador de números aleatórios (Mersenne Twister)
+    const DCKPInstance &instance_;           ///< Referência para a instância
+    std::shared_ptr<ItemOrderCache> orders_; ///< Ordenações pré-calculadas (compartilháveis)
+    /// Estado do fluxo sequencial, um tipo por RngEngine
+    using EngineState = std::variant<prng::Xoshiro256StarStar, prng::Pcg32, std::mt19937>;
+
+    RngEngine engine_;                       ///< Gerador configurado
+    EngineState rng_;                        ///< Fluxo sequencial do gerador configurado
+    unsigned int seed_;                      ///< Semente base (deriva os fluxos do modo paralelo)
+    bool parallel_;                          ///< Modo paralelo ativo
+    unsigned int n_threads_;                 ///< Threads do modo paralelo (0 = automático)
+    GRASPStats stats_;                       ///< Estatísticas da última execução
+    GRASPLocalSearch ls_method_;             ///< Busca local sobre as construções
+    int ls_top_k_;                           ///< Construções melhoradas (0 = todas)
+    int ls_max_iterations_;                  ///< Iterações máximas de cada busca local
+    PivotRule ls_pivot_;                     ///< Regra de escolha da busca local
+    RCLType rcl_type_;                       ///< Critério da RCL
+    PathRelinkingMode pr_mode_;              ///< Direção do path relinking
+    int elite_size_;                         ///< Capacidade do conjunto elite
+    int elite_min_distance_;                 ///< Distância mínima de aceitação no conjunto elite
+    std::unique_ptr<ElitePool> elite_pool_;  ///< Conjunto elite da execução corrente
+    bool duplicate_filter_enabled_;          ///< Filtro de duplicatas ativo
+    int duplicate_filter_capacity_;          ///< Posições da tabela de assinaturas
+    std::unique_ptr<DuplicateFilter> duplicate_filter_; ///< Filtro de duplicatas da execução corrente
+
+    static constexpr double REACTIVE_DELTA = 10.0; ///< Expoente que amplifica diferenças entre médias
+
+    /**
+     * @brief Estatísticas de um alpha no GRASP reativo, atualizadas por várias threads
+     * @note Alinhado à linha de cache para evitar falso compartilhamento
+     */
+    struct alignas(64) AlphaPool
+    {
+        std::atomic<int> uses{0};             ///< Construções com este alpha
+        std::atomic<long long> profit_sum{0}; ///< Soma dos lucros (inviável conta 0)
+        std::atomic<int> best_profit{-1};     ///< Melhor lucro
+    };
+
+    /**
+     * @brief Estado compartilhado do GRASP reativo
+     */
+    struct ReactiveState
+    {
+        std::span<const double> alphas; ///< Valores de alpha
+        std::vector<AlphaPool> pools;   ///< Um pool por alpha
+    };
+
+    /**
+     * @brief Construção guardada para a busca local dos top-k
+     */
+    struct RankedSolution
+    {
+        Solution solution;  ///< Solução construída
+        int iteration = -1; ///< Iteração que a gerou (desempate)
+    };
+
+    /**
+     * @brief Tempos e contadores do pipeline construção + busca local
+     */
+    struct PipelineTotals
+    {
+        double construction_time = 0.0;    ///< Tempo de construção
+        double local_search_time = 0.0;    ///< Tempo de busca local
+        int local_searches = 0;            ///< Buscas locais executadas
+        int local_search_improvements = 0; ///< Buscas que melhoraram a solução
+        double relink_time = 0.0;          ///< Tempo de path relinking
+        int relinks = 0;                   ///< Path relinkings executados
+        int relink_improvements = 0;       ///< Path relinkings que melhoraram a solução
+        int signature_checks = 0;          ///< Construções consultadas no filtro
+        int duplicates = 0;                ///< Construções repetidas
+
+        /**
+         * @brief Acumula os totais de outra thread
+         * @param other Totais a somar
+         */
+        void merge(const PipelineTotals &other) noexcept;
+    };
 
     /**
-     * @brief Estrutura para armazenar candidatos
+     * @brief Estado de uma thread do pipeline, reaproveitado entre iterações
      */
-    struct Candidate
+    struct PipelineWorker
     {
-        int item_id;
-        double score;
+        /**
+         * @brief Construtor
+         * @param inst Referência para a instância
+         */
+        explicit PipelineWorker(const DCKPInstance &inst) noexcept;
 
-        [[nodiscard]] bool operator>(const Candidate &other) const noexcept
-        {
-            return score > other.score;
-        }
+        HillClimbing hill_climbing;        ///< Busca local com buffers próprios
+        VND vnd;                           ///< Busca local com buffers próprios
+        PathRelinking relinker;            ///< Path relinking com buffers próprios
+        std::vector<RankedSolution> elite; ///< Top-k construções desta thread
+        PipelineTotals totals;             ///< Tempos e contadores desta thread
+    };
+
+    /**
+     * @brief Conjunto incremental de candidatos de uma construção
+     *
+     * Os candidatos são indexados pela posição (rank) na ordem decrescente de
+     * score. Uma Fenwick tree marca os ranks ainda viáveis, o que dá em
+     * O(log n) o melhor e o pior candidato (limites do threshold), o tamanho
+     * da RCL e o k-ésimo candidato da RCL. Os buffers são reaproveitados
+     * entre construções.
+     */
+    struct CandidateSet
+    {
+        FenwickTree active_ranks; ///< 1 para ranks ainda candidatos
+        std::vector<char> alive;  ///< Flag de candidato por rank
+        int alive_count = 0;      ///< Número de candidatos
+        int heavy_pos = 0;        ///< Próximo item (do mais pesado) a testar contra a capacidade
     };
 
+    std::vector<int> rank_of_;       ///< Rank de cada item na ordem PENALIZED_RATIO
+    std::vector<double> rank_score_; ///< Score por rank (não crescente)
+    CandidateSet candidates_;        ///< Estruturas reaproveitadas entre construções
+
+    /**
+     * @brief Número de threads das iterações
+     * @return 1 no modo sequencial; senão o definido em setParallel
+     *         (0 → ThreadPool::defaultThreadCount())
+     */
+    [[nodiscard]] unsigned int threadCount() const noexcept;
+
+    /**
+     * @brief Recria o conjunto elite vazio se o path relinking está ativo
+     */
+    void resetElitePool();
+
+    /**
+     * @brief Recria (ou descarta) o filtro de duplicatas para uma nova execução
+     */
+    void resetDuplicateFilter();
+
+    /**
+     * @brief Calcula rank_of_ e rank_score_ a partir do cache (uma vez)
+     * @note Deve ser chamado antes de construções concorrentes
+     */
+    void prepareRanks();
+
+    /**
+     * @brief Executa as iterações em sequência com o fluxo único de rng_
+     * @param iterations Número máximo de iterações
+     * @param alpha Parâmetro de controle da RCL
+     * @param deadline Limite de tempo
+     * @param profits Recebe o lucro de cada iteração concluída, em ordem (-1 se inviável)
+     * @param rng Fluxo sequencial (continua entre chamadas de solve)
+     * @param worker Busca local, top-k e totais do pipeline
+     * @return Melhor solução encontrada
+     */
+    template <typename Engine>
+    [[nodiscard]] Solution runSequential(int iterations, double alpha, const Deadline &deadline,
+                                         std::vector<int> &profits, Engine &rng, PipelineWorker &worker);
+
     /**
-     * @brief Calcula o score de um item baseado em valor/peso
-     * @param item Índice do item
-     * @param current_solution Solução parcial atual
-     * @return Score calculado
+     * @brief Executa as iterações em paralelo com fluxos por iteração
+     * @param iterations Número máximo de iterações
+     * @param alpha Parâmetro de controle da RCL (ignorado se reactive != nullptr)
+     * @param reactive Pools do GRASP reativo, ou nullptr para alpha fixo
+     * @param deadline Limite de tempo
+     * @param profits Recebe o lucro de cada iteração concluída, em ordem (-1 se inviável)
+     * @param elite Recebe as top-k construções de todas as threads
+     * @param totals Recebe os totais do pipeline somados entre threads
+     * @return Melhor solução (maior lucro, menor iteração no empate)
      */
-    [[nodiscard]] double calculateScore(int item, const Solution &current_solution) const noexcept;
+    template <typename Engine>
+    [[nodiscard]] Solution runParallel(int iterations, double alpha, ReactiveState *reactive,
+                                       const Deadline &deadline, std::vector<int> &profits,
+                                       std::vector<RankedSolution> &elite, PipelineTotals &totals) const;
 
     /**
-     * @brief Constrói a Lista Restrita de Candidatos
-     * @param current_solution Solução parcial atual
-     * @param alpha Parâmetro de controle da RCL (0 = guloso, 1 = aleatório)
-     * @return Vetor de candidatos na RCL
+     * @brief Uma iteração do pipeline: construção e, se configurada, busca local
+     * @param alpha Parâmetro de controle da RCL
+     * @param iteration Índice da iteração
+     * @param set Estruturas de candidatos da thread
+     * @param rng Gerador aleatório da iteração
+     * @param worker Estado da thread
+     * @param deadline Limite de tempo repassado à busca local
+     * @param profit Recebe o lucro reportado às estatísticas e ao alpha reativo
+     *               (-1 se inviável; o da primeira ocorrência, para uma repetição)
+     * @return Solução da iteração (melhorada se top_k = 0 e/ou pelo path relinking)
      */
-    [[nodiscard]] std::vector<int> buildRCL(const Solution &current_solution, double alpha) const;
+    template <typename Engine>
+    [[nodiscard]] Solution runIteration(double alpha, int iteration, CandidateSet &set, Engine &rng,
+                                        PipelineWorker &worker, const Deadline &deadline, int &profit) const;
 
     /**
-     * @brief Seleciona aleatoriamente um item da RCL
-     * @param rcl Lista Restrita de Candidatos
-     * @return Índice do item selecionado, ou -1 se RCL vazia
+     * @brief Aplica a busca local configurada e acumula tempo e contadores
+     * @param solution Solução melhorada no lugar
+     * @param worker Estado da thread
+     * @param deadline Limite de tempo
+     * @param iteration Iteração que gerou a solução (semente da ordem aleatória)
      */
-    [[nodiscard]] int selectFromRCL(const std::vector<int> &rcl);
+    void applyLocalSearch(Solution &solution, PipelineWorker &worker, const Deadline &deadline,
+                          int iteration) const;
+
+    /**
+     * @brief Liga a solução a um membro elite e a oferece ao conjunto elite
+     * @param solution Solução substituída pela intermediária se esta for melhor
+     * @param worker Estado da thread
+     * @param random Valor aleatório para sortear o membro elite
+     */
+    void relinkWithElite(Solution &solution, PipelineWorker &worker, std::uint32_t random) const;
+
+    /**
+     * @brief Oferece uma construção ao top-k da thread (copia só se entrar)
+     * @param elite Top-k da thread
+     * @param solution Construção
+     * @param iteration Iteração que a gerou
+     */
+    void offerElite(std::vector<RankedSolution> &elite, const Solution &solution, int iteration) const;
+
+    /**
+     * @brief Aplica a busca local às top-k construções
+     * @param elite Construções guardadas por todas as threads
+     * @param concurrent true para distribuir as buscas no ThreadPool
+     * @param deadline Limite de tempo
+     * @param totals Totais do pipeline (acumula o tempo de busca)
+     * @return Melhor solução melhorada (lucro -1 se elite vazia)
+     */
+    [[nodiscard]] Solution improveElite(std::vector<RankedSolution> &elite, bool concurrent,
+                                        const Deadline &deadline, PipelineTotals &totals) const;
+
+    /**
+     * @brief Ordem do top-k: maior lucro, menor iteração no empate
+     */
+    [[nodiscard]] static bool rankedBefore(const RankedSolution &a, const RankedSolution &b) noexcept;
+
+    /**
+     * @brief Pesos acumulados de seleção dos alphas a partir dos pools
+     * @param state Estado do GRASP reativo
+     * @param cumulative Recebe os pesos acumulados (um por alpha)
+     */
+    static void reactiveWeights(const ReactiveState &state, std::vector<double> &cumulative);
+
+    /**
+     * @brief Sorteia o índice do alpha da próxima construção
+     * @param state Estado do GRASP reativo
+     * @param cumulative Buffer de pesos acumulados (reaproveitado pela thread)
+     * @param rng Gerador aleatório da iteração
+     * @return Índice em state.alphas
+     */
+    template <typename Engine>
+    [[nodiscard]] static std::size_t chooseAlpha(const ReactiveState &state,
+                                                 std::vector<double> &cumulative, Engine &rng);
+
+    /**
+     * @brief Registra o resultado de uma construção no pool do seu alpha
+     * @param pool Pool do alpha usado
+     * @param profit Lucro obtido (-1 se inviável)
+     */
+    static void recordAlpha(AlphaPool &pool, int profit) noexcept;
+
+    /**
+     * @brief Preenche stats_ a partir dos lucros por iteração
+     * @param profits Lucro de cada iteração concluída, em ordem (-1 se inviável)
+     * @param iterations Número máximo de iterações pedido
+     * @param totals Totais do pipeline construção + busca local
+     */
+    void updateStats(const std::vector<int> &profits, int iterations, const PipelineTotals &totals);
+
+    /**
+     * @brief Imprime a linha de resumo de uma execução
+     * @param best Melhor solução
+     * @param header Prefixo da linha (método e parâmetros)
+     */
+    void printSummary(const Solution &best, std::string_view header) const;
+
+    /**
+     * @brief Remove um rank do conjunto de candidatos (idempotente)
+     * @param set Conjunto de candidatos
+     * @param rank Rank a remover
+     */
+    static void removeCandidate(CandidateSet &set, int rank) noexcept;
+
+    /**
+     * @brief Tamanho da RCL no estado atual do conjunto de candidatos
+     * @param alpha Parâmetro de controle da RCL
+     * @param set Conjunto de candidatos (não vazio)
+     * @return Número de candidatos (os de menor rank) que formam a RCL
+     */
+    [[nodiscard]] int rclSize(double alpha, const CandidateSet &set) const noexcept;
+
+    /**
+     * @brief Sorteia uma posição da RCL
+     * @param rcl_size Tamanho da RCL
+     * @param rng Gerador aleatório da construção
+     * @return Índice uniforme em [0, rcl_size)
+     * @note Com std::mt19937 usa uniform_int_distribution (resultados antigos);
+     *       com os demais geradores, prng::bounded (sem divisão no caso comum)
+     */
+    template <typename Engine>
+    [[nodiscard]] static int selectFromRCL(int rcl_size, Engine &rng);
 
     /**
      * @brief Constrói uma única solução usando o procedimento GRASP
+     *
+     * A cada inserção só são removidos do conjunto de candidatos o item
+     * escolhido, seus vizinhos no grafo de conflitos e os itens que deixaram
+     * de caber (varridos do mais pesado para o mais leve). O score de um
+     * candidato viável não depende da solução parcial, logo nenhum score
+     * precisa ser recalculado. O threshold vem do melhor e do pior candidato
+     * restantes, sem ordenação. Custo: O(n log n + m) por construção.
+     *
      * @param alpha Parâmetro de controle da aleatoriedade [0, 1]
+     * @param set Estruturas de candidatos (reaproveitadas entre construções)
+     * @param rng Gerador aleatório da construção
      * @return Solução construída
+     * @note Thread-safe para set e rng distintos, após prepareRanks()
+     */
+    template <typename Engine>
+    [[nodiscard]] Solution constructSolution(double alpha, CandidateSet &set, Engine &rng) const;
+
+    /**
+     * @brief Cria o fluxo sequencial do gerador configurado
+     * @param engine Gerador
+     * @param seed Semente
+     * @return Estado inicial do fluxo
      */
-    [[nodiscard]] Solution constructSolution(double alpha);
+    [[nodiscard]] static EngineState makeEngine(RngEngine engine, unsigned int seed) noexcept;
 };
 
 #endif // GRASP_H
@@ -5,108 +5,345 @@
 
 #include "greedy.h"
 
+#include "../utils/thread_pool.h"
+#include "greedy_policies.h"
+
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <queue>
 #include <ranges>
+#include <sstream>
 
-GreedyConstructive::GreedyConstructive(const DCKPInstance &inst) noexcept
-    : instance_(inst), validator_(inst) {}
+GreedyConstructive::GreedyConstructive(const DCKPInstance &inst)
+    : GreedyConstructive(inst, std::make_shared<ItemOrderCache>(inst)) {}
 
-double GreedyConstructive::calculateScore(int item, GreedyStrategy strategy) const noexcept
+GreedyConstructive::GreedyConstructive(const DCKPInstance &inst,
+                                       std::shared_ptr<ItemOrderCache> orders) noexcept
+    : instance_(inst),
+      validator_(inst),
+      orders_(std::move(orders)),
+      sort_mode_(SortMode::AUTO),
+      min_weight_(0),
+      initial_chunk_(0)
 {
-    switch (strategy)
+    if (instance_.n_items <= 0)
     {
-    case GreedyStrategy::MAX_PROFIT:
-        return static_cast<double>(instance_.profits[item]);
+        return;
+    }
 
-    case GreedyStrategy::MIN_WEIGHT:
-        return -static_cast<double>(instance_.weights[item]);
+    long long weight_sum = 0;
+    min_weight_ = instance_.weights[0];
+    for (int w : instance_.weights)
+    {
+        weight_sum += w;
+        min_weight_ = std::min(min_weight_, w);
+    }
 
-    case GreedyStrategy::MAX_PROFIT_WEIGHT:
-        if (instance_.weights[item] == 0)
+    // Primeiro bloco: algumas vezes o número esperado de itens na mochila
+    const double mean_weight = std::max(1.0, static_cast<double>(weight_sum) / instance_.n_items);
+    const auto expected_fit = static_cast<std::size_t>(instance_.capacity / mean_weight);
+    initial_chunk_ = std::max<std::size_t>(256, 4 * expected_fit);
+}
+
+namespace
+{
+    [[nodiscard]] double secondsSince(std::chrono::steady_clock::time_point start) noexcept
+    {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+} // namespace
+
+SortMode GreedyConstructive::resolveSortMode(bool integral_key) const noexcept
+{
+    switch (sort_mode_)
+    {
+    case SortMode::AUTO:
+        if (instance_.n_items < AUTO_SORT_MIN_ITEMS)
         {
-            return static_cast<double>(instance_.profits[item]) * 1000.0;
+            return SortMode::COMPARISON;
         }
-        return static_cast<double>(instance_.profits[item]) /
-               static_cast<double>(instance_.weights[item]);
+        return integral_key ? SortMode::RADIX : SortMode::PARTIAL;
 
-    case GreedyStrategy::MIN_CONFLICTS:
-        return -static_cast<double>(instance_.getConflictDegree(item));
+    case SortMode::RADIX:
+        return integral_key ? SortMode::RADIX : SortMode::COMPARISON;
+
+    case SortMode::COMPARISON:
+    case SortMode::PARTIAL:
+        return sort_mode_;
     }
-    return 0.0;
+    return SortMode::COMPARISON;
 }
 
-std::vector<int> GreedyConstructive::sortItemsByStrategy(GreedyStrategy strategy) const
+template <typename Policy>
+Solution GreedyConstructive::constructWith(GreedyTiming &timing) const
 {
-    std::vector<ItemScore> scores;
-    scores.reserve(static_cast<std::size_t>(instance_.n_items));
+    using Traits = greedy_policy::SortEntry<Policy>;
+    using Entry = typename Traits::Entry;
+
+    const SortMode mode = resolveSortMode(greedy_policy::has_integral_key<Policy>);
+    timing = GreedyTiming{};
+    timing.sort_mode = mode;
 
-    for (int i = 0; i < instance_.n_items; ++i)
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+    Solution solution;
+
+    // Insere gulosamente; retorna false quando nenhum item cabe mais
+    const auto scan = [&](auto first, auto last, auto item_of)
     {
-        scores.push_back({i, calculateScore(i, strategy)});
+        for (; first != last; ++first)
+        {
+            if (instance_.capacity - solution.total_weight < min_weight_)
+            {
+                return false;
+            }
+
+            const int item = item_of(*first);
+            if (!validator_.checkCapacity(solution.total_weight, instance_.weights[item]))
+            {
+                continue;
+            }
+
+            if (!validator_.checkConflicts(item, solution.selected_items))
+            {
+                continue;
+            }
+
+            solution.addItem(item, instance_.profits[item], instance_.weights[item]);
+        }
+        return true;
+    };
+
+    auto phase_start = std::chrono::steady_clock::now();
+
+    if (mode != SortMode::PARTIAL || orders_->contains(Policy::order_key))
+    {
+        timing.from_cache = orders_->contains(Policy::order_key);
+        const std::vector<int> &order = orders_->order(Policy::order_key, mode);
+        timing.sort_time = secondsSince(phase_start);
+
+        phase_start = std::chrono::steady_clock::now();
+        scan(order.begin(), order.end(), [](int item)
+             { return item; });
+        timing.scan_time = secondsSince(phase_start);
+
+        return solution;
     }
 
-    std::ranges::sort(scores, std::greater<>{});
+    // Kernel de scoring: laço simples sobre os vetores da instância
+    std::vector<Entry> entries(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        entries[i] = Traits::make(instance_, static_cast<int>(i));
+    }
 
-    std::vector<int> result;
-    result.reserve(scores.size());
-    for (const auto &s : scores)
+    std::size_t sorted = 0;
+    std::size_t chunk = initial_chunk_;
+    bool open = true;
+
+    while (open && sorted < n)
     {
-        result.push_back(s.item_id);
+        const std::size_t end = std::min(n, sorted + chunk);
+        const auto first = entries.begin() + static_cast<std::ptrdiff_t>(sorted);
+        const auto last = entries.begin() + static_cast<std::ptrdiff_t>(end);
+
+        if (end < n)
+        {
+            std::nth_element(first, last, entries.end(), Traits::before);
+        }
+        std::sort(first, last, Traits::before);
+        timing.sort_time += secondsSince(phase_start);
+
+        phase_start = std::chrono::steady_clock::now();
+        open = scan(first, last, [](const Entry &e)
+                    { return Traits::item(e); });
+        timing.scan_time += secondsSince(phase_start);
+
+        phase_start = std::chrono::steady_clock::now();
+        sorted = end;
+        chunk *= 2;
     }
 
-    return result;
+    return solution;
 }
 
-Solution GreedyConstructive::construct(GreedyStrategy strategy)
+Solution GreedyConstructive::constructResidualDegree(GreedyTiming &timing) const
 {
-    const auto start = std::chrono::steady_clock::now();
+    using Ratio = greedy_policy::MaxProfitWeight;
+
+    const SortMode mode = resolveSortMode(greedy_policy::has_integral_key<Ratio>);
+    timing = GreedyTiming{};
+    timing.sort_mode = mode;
+
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+
+    // Desempate pela posição na ordem de valor/peso do cache (menor índice no empate)
+    auto phase_start = std::chrono::steady_clock::now();
+    timing.from_cache = orders_->contains(Ratio::order_key);
+    const std::vector<int> &order = orders_->order(Ratio::order_key, mode);
+    timing.sort_time = secondsSince(phase_start);
+
+    phase_start = std::chrono::steady_clock::now();
+    std::vector<int> rank(n);
+    for (std::size_t r = 0; r < n; ++r)
+    {
+        rank[static_cast<std::size_t>(order[r])] = static_cast<int>(r);
+    }
+
+    // Heap de mínimo por (grau residual, rank). Um decremento empilha a nova
+    // chave; a antiga fica para trás e é descartada ao sair (grau diferente)
+    using Entry = std::pair<int, int>;
+    std::vector<Entry> entries(n);
+    std::vector<int> degree(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        degree[i] = instance_.getConflictDegree(static_cast<int>(i));
+        entries[i] = {degree[i], rank[i]};
+    }
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> heap(std::greater<>{}, std::move(entries));
+    std::vector<char> active(n, 1);
+
+    // Retira um item do grafo residual: seus vizinhos ativos perdem um grau
+    const auto retire = [&](int item)
+    {
+        active[static_cast<std::size_t>(item)] = 0;
+        for (int neighbor : instance_.conflict_graph[item])
+        {
+            const auto v = static_cast<std::size_t>(neighbor);
+            if (!active[v])
+            {
+                continue;
+            }
+            --degree[v];
+            heap.emplace(degree[v], rank[v]);
+        }
+    };
 
     Solution solution;
-    solution.method_name = std::string("Greedy_") + std::string(strategyToString(strategy));
 
-    for (int item : sortItemsByStrategy(strategy))
+    while (!heap.empty())
     {
-        if (!validator_.checkCapacity(solution.total_weight, instance_.weights[item]))
+        const auto [d, r] = heap.top();
+        heap.pop();
+        const int item = order[static_cast<std::size_t>(r)];
+        if (!active[static_cast<std::size_t>(item)] || degree[static_cast<std::size_t>(item)] != d)
         {
             continue;
         }
 
-        if (!validator_.checkConflicts(item, solution.selected_items))
+        if (!validator_.checkCapacity(solution.total_weight, instance_.weights[item]))
         {
+            retire(item);
             continue;
         }
 
         solution.addItem(item, instance_.profits[item], instance_.weights[item]);
+        active[static_cast<std::size_t>(item)] = 0;
+
+        // Vizinhos do item escolhido deixam o grafo residual
+        for (int neighbor : instance_.conflict_graph[item])
+        {
+            if (active[static_cast<std::size_t>(neighbor)])
+            {
+                retire(neighbor);
+            }
+        }
     }
 
+    timing.scan_time = secondsSince(phase_start);
+    return solution;
+}
+
+GreedyConstructive::BuildResult GreedyConstructive::buildSolution(GreedyStrategy strategy) const
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    // Tabela de despacho indexada pela ordem de declaração de GreedyStrategy
+    using Builder = Solution (GreedyConstructive::*)(GreedyTiming &) const;
+    static constexpr std::array<Builder, 5> builders = {
+        &GreedyConstructive::constructWith<greedy_policy::MaxProfit>,
+        &GreedyConstructive::constructWith<greedy_policy::MinWeight>,
+        &GreedyConstructive::constructWith<greedy_policy::MaxProfitWeight>,
+        &GreedyConstructive::constructWith<greedy_policy::MinConflicts>,
+        &GreedyConstructive::constructResidualDegree};
+
+    BuildResult result;
+    result.solution = (this->*builders[static_cast<std::size_t>(strategy)])(result.timing);
+
+    Solution &solution = result.solution;
+    solution.method_name = std::string("Greedy_") + std::string(strategyToString(strategy));
+
     validator_.validate(solution);
+    solution.computation_time = secondsSince(start);
 
-    const auto end = std::chrono::steady_clock::now();
-    const std::chrono::duration<double> elapsed = end - start;
-    solution.computation_time = elapsed.count();
+    return result;
+}
 
-    std::cout << "Greedy (" << strategyToString(strategy) << "): "
-              << "Valor = " << solution.total_profit
-              << ", Itens = " << solution.size()
-              << ", Tempo = " << solution.computation_time << "s\n";
+std::string GreedyConstructive::formatSummary(GreedyStrategy strategy, const BuildResult &result)
+{
+    const Solution &solution = result.solution;
+    std::ostringstream ss;
+    ss << "Greedy (" << strategyToString(strategy) << "): "
+       << "Valor = " << solution.total_profit
+       << ", Itens = " << solution.size()
+       << ", Tempo = " << solution.computation_time << "s";
 
-    return solution;
+    if (strategy != GreedyStrategy::RESIDUAL_DEGREE)
+    {
+        ss << " [" << (result.timing.from_cache ? std::string_view("Cache")
+                                                 : sortModeToString(result.timing.sort_mode))
+           << ": Ordenacao = " << result.timing.sort_time << "s"
+           << ", Varredura = " << result.timing.scan_time << "s]";
+    }
+    ss << '\n';
+    return ss.str();
+}
+
+Solution GreedyConstructive::construct(GreedyStrategy strategy)
+{
+    BuildResult result = buildSolution(strategy);
+    std::cout << formatSummary(strategy, result);
+    return std::move(result.solution);
 }
 
 std::vector<Solution> GreedyConstructive::constructAll()
 {
     std::cout << "\n--- Estrategias Greedy ---\n";
 
-    std::vector<Solution> solutions;
-    solutions.reserve(4);
+    constexpr std::array strategies = {
+        GreedyStrategy::MAX_PROFIT,
+        GreedyStrategy::MIN_WEIGHT,
+        GreedyStrategy::MAX_PROFIT_WEIGHT,
+        GreedyStrategy::MIN_CONFLICTS,
+        GreedyStrategy::RESIDUAL_DEGREE};
 
-    solutions.push_back(construct(GreedyStrategy::MAX_PROFIT));
-    solutions.push_back(construct(GreedyStrategy::MIN_WEIGHT));
-    solutions.push_back(construct(GreedyStrategy::MAX_PROFIT_WEIGHT));
-    solutions.push_back(construct(GreedyStrategy::MIN_CONFLICTS));
+    std::vector<std::future<BuildResult>> pending;
+    pending.reserve(strategies.size());
+    {
+        ThreadPool pool(std::min(ThreadPool::defaultThreadCount(),
+                                 static_cast<unsigned int>(strategies.size())));
+
+        for (const GreedyStrategy strategy : strategies)
+        {
+            pending.push_back(pool.submit([this, strategy]
+                                          { return buildSolution(strategy); }));
+        }
+    }
+
+    // Coleta na ordem das estratégias: saída e resultados determinísticos
+    std::vector<Solution> solutions;
+    solutions.reserve(strategies.size());
+    for (std::size_t i = 0; i < strategies.size(); ++i)
+    {
+        BuildResult result = pending[i].get();
+        std::cout << formatSummary(strategies[i], result);
+        solutions.push_back(std::move(result.solution));
+    }
 
     const auto best = std::ranges::max_element(solutions, {},
                                                [](const Solution &s)
@@ -128,6 +365,29 @@ std::string_view GreedyConstructive::strategyToString(GreedyStrategy strategy) n
         return "MaxProfitWeight";
     case GreedyStrategy::MIN_CONFLICTS:
         return "MinConflicts";
+    case GreedyStrategy::RESIDUAL_DEGREE:
+        return "ResidualDegree";
+    }
+    return "Unknown";
+}
+
+void GreedyConstructive::setSortMode(SortMode mode) noexcept
+{
+    sort_mode_ = mode;
+}
+
+std::string_view GreedyConstructive::sortModeToString(SortMode mode) noexcept
+{
+    switch (mode)
+    {
+    case SortMode::AUTO:
+        return "Auto";
+    case SortMode::COMPARISON:
+        return "Comparison";
+    case SortMode::RADIX:
+        return "Radix";
+    case SortMode::PARTIAL:
+        return "Partial";
     }
     return "Unknown";
 }
@@ -15,7 +15,10 @@
 #include "../utils/instance_reader.h"
 #include "../utils/solution.h"
 #include "../utils/validator.h"
+#include "item_order_cache.h"
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -29,7 +32,20 @@ enum class GreedyStrategy
     MAX_PROFIT,        ///< Ordena por maior valor
     MIN_WEIGHT,        ///< Ordena por menor peso
     MAX_PROFIT_WEIGHT, ///< Ordena por maior razão valor/peso
-    MIN_CONFLICTS      ///< Ordena por menor número de conflitos
+    MIN_CONFLICTS,     ///< Ordena por menor número de conflitos
+    RESIDUAL_DEGREE    ///< Menor grau residual, desempate por maior valor/peso
+};
+
+/**
+ * @struct GreedyTiming
+ * @brief Tempos separados de ordenação e varredura de uma construção gulosa
+ */
+struct GreedyTiming
+{
+    double sort_time = 0.0;              ///< Tempo de cálculo de chaves e ordenação (s)
+    double scan_time = 0.0;              ///< Tempo da varredura de inserção (s)
+    SortMode sort_mode = SortMode::AUTO; ///< Algoritmo efetivamente usado
+    bool from_cache = false;             ///< Ordem reaproveitada do ItemOrderCache
 };
 
 /**
@@ -46,7 +62,14 @@ public:
      * @brief Construtor
      * @param inst Referência para a instância do problema
      */
-    explicit GreedyConstructive(const DCKPInstance &inst) noexcept;
+    explicit GreedyConstructive(const DCKPInstance &inst);
+
+    /**
+     * @brief Construtor com cache de ordenações compartilhado
+     * @param inst Referência para a instância do problema
+     * @param orders Cache de ordenações da mesma instância (ex.: também usado pelo GRASP)
+     */
+    GreedyConstructive(const DCKPInstance &inst, std::shared_ptr<ItemOrderCache> orders) noexcept;
 
     /**
      * @brief Constrói uma solução usando estratégia gulosa
@@ -57,6 +80,11 @@ public:
 
     /**
      * @brief Constrói soluções com todas as estratégias
+     *
+     * As estratégias são executadas concorrentemente em um ThreadPool
+     * (a instância é somente leitura). Os resultados e as linhas de log
+     * são coletados na ordem de declaração das estratégias.
+     *
      * @return Vetor com todas as soluções geradas
      */
     [[nodiscard]] std::vector<Solution> constructAll();
@@ -68,38 +96,98 @@ public:
      */
     [[nodiscard]] static std::string_view strategyToString(GreedyStrategy strategy) noexcept;
 
+    /**
+     * @brief Define o algoritmo de ordenação (default: SortMode::AUTO)
+     * @param mode Modo de ordenação
+     * @note RADIX em estratégia de chave real recai para COMPARISON
+     */
+    void setSortMode(SortMode mode) noexcept;
+
+    /**
+     * @brief Converte modo de ordenação para string
+     * @param mode Modo de ordenação
+     * @return Nome do modo
+     */
+    [[nodiscard]] static std::string_view sortModeToString(SortMode mode) noexcept;
+
 private:
-    const DCKPInstance &instance_; ///< Referência para a instância
-    Validator validator_;          ///< Validador de soluções
+    /// Abaixo deste número de itens, AUTO usa ordenação por comparação
+    static constexpr int AUTO_SORT_MIN_ITEMS = 2048;
+
+    const DCKPInstance &instance_;           ///< Referência para a instância
+    Validator validator_;                    ///< Validador de soluções
+    std::shared_ptr<ItemOrderCache> orders_; ///< Ordenações pré-calculadas (compartilháveis)
+    SortMode sort_mode_;                     ///< Modo de ordenação configurado
+    int min_weight_;                         ///< Menor peso da instância (parada antecipada)
+    std::size_t initial_chunk_;              ///< Tamanho do primeiro bloco no modo PARTIAL
 
     /**
-     * @brief Estrutura auxiliar para ordenação de itens
+     * @brief Resultado interno de uma construção gulosa
      */
-    struct ItemScore
+    struct BuildResult
     {
-        int item_id;
-        double score;
-
-        [[nodiscard]] bool operator>(const ItemScore &other) const noexcept
-        {
-            return score > other.score;
-        }
+        Solution solution;
+        GreedyTiming timing;
     };
 
     /**
-     * @brief Calcula o score de um item baseado na estratégia
-     * @param item Índice do item
-     * @param strategy Estratégia de scoring
-     * @return Score calculado
+     * @brief Constrói, valida e cronometra uma solução sem escrever no stdout
+     * @param strategy Estratégia de construção
+     * @return Solução (com nome e tempo preenchidos) e tempos por fase
+     * @note Thread-safe: apenas lê a instância
+     */
+    [[nodiscard]] BuildResult buildSolution(GreedyStrategy strategy) const;
+
+    /**
+     * @brief Formata a linha de log de uma solução gulosa
+     * @param strategy Estratégia usada
+     * @param result Solução construída e tempos por fase
+     * @return Linha de resumo terminada em '\n'
+     */
+    [[nodiscard]] static std::string formatSummary(GreedyStrategy strategy, const BuildResult &result);
+
+    /**
+     * @brief Resolve SortMode::AUTO para um modo concreto
+     * @param integral_key true se a chave da estratégia é inteira
+     * @return Modo de ordenação a usar
+     */
+    [[nodiscard]] SortMode resolveSortMode(bool integral_key) const noexcept;
+
+    /**
+     * @brief Motor de construção especializado para uma política
+     *
+     * Obtém a ordem do ItemOrderCache (ordenando uma única vez conforme o
+     * SortMode resolvido) e insere os itens gulosamente. A varredura termina
+     * assim que a capacidade residual fica abaixo do menor peso da instância.
+     * No modo PARTIAL, se a ordem ainda não está no cache, só os blocos
+     * efetivamente varridos são ordenados (e nada é armazenado). Empates são
+     * desfeitos pelo menor índice em todos os modos, que produzem a mesma ordem.
+     *
+     * @tparam Policy Política de greedy_policy (ver greedy_policies.h)
+     * @param timing Recebe os tempos de ordenação e de varredura
+     * @return Solução construída (sem tempo nem nome preenchidos)
      */
-    [[nodiscard]] double calculateScore(int item, GreedyStrategy strategy) const noexcept;
+    template <typename Policy>
+    [[nodiscard]] Solution constructWith(GreedyTiming &timing) const;
 
     /**
-     * @brief Ordena itens pela estratégia escolhida
-     * @param strategy Estratégia de ordenação
-     * @return Vetor de itens ordenados
+     * @brief Constrói uma solução pelo menor grau residual no grafo de conflitos
+     *
+     * Heurística no estilo de conjunto independente de peso máximo: a cada passo
+     * escolhe o item ativo de menor grau residual, descarta seus vizinhos e
+     * decrementa o grau dos vizinhos dos descartados. No empate de grau vence
+     * a maior razão valor/peso (posição na ordem MAX_PROFIT_WEIGHT do cache,
+     * menor índice no empate). Os itens ficam num heap de mínimo por (grau,
+     * posição na ordem); cada decremento empilha a chave nova e as antigas
+     * são descartadas ao sair.
+     *
+     * @param timing Recebe o tempo da ordem por valor/peso (zero se já está no
+     *               cache) e o da construção
+     * @return Solução construída (sem tempo nem nome preenchidos)
+     * @note Complexidade: O((n + m) log(n + m)), m = número de arestas de
+     *       conflito, mais a ordenação quando ela não está no cache
      */
-    [[nodiscard]] std::vector<int> sortItemsByStrategy(GreedyStrategy strategy) const;
+    [[nodiscard]] Solution constructResidualDegree(GreedyTiming &timing) const;
 };
 
 #endif // GREEDY_H
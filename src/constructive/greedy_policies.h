@@ -0,0 +1,184 @@
+/**
+ * @file greedy_policies.h
+ * @brief Políticas de ordenação em tempo de compilação para o Guloso
+ *
+ * Cada estratégia gulosa é um tipo com uma função key() estática e constexpr.
+ * O motor de construção é instanciado por política, de modo que o laço de
+ * scoring é inlinado (e vetorizável) e estratégias com chave inteira evitam
+ * ponto flutuante na ordenação.
+ *
+ * Convenção: itens com MAIOR chave são considerados primeiro.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef GREEDY_POLICIES_H
+#define GREEDY_POLICIES_H
+
+#include "../utils/instance_reader.h"
+#include "../utils/sorting.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @enum OrderKey
+ * @brief Identifica uma ordenação de itens (chave do ItemOrderCache)
+ */
+enum class OrderKey
+{
+    MAX_PROFIT,        ///< Maior valor primeiro
+    MIN_WEIGHT,        ///< Menor peso primeiro
+    MAX_PROFIT_WEIGHT, ///< Maior razão valor/peso primeiro
+    MIN_CONFLICTS,     ///< Menor grau de conflito primeiro
+    PENALIZED_RATIO    ///< Razão valor/peso penalizada pelo grau (score do GRASP)
+};
+
+/// Número de valores de OrderKey
+inline constexpr std::size_t ORDER_KEY_COUNT = 5;
+
+namespace greedy_policy
+{
+    /**
+     * @brief Maior valor primeiro (chave inteira)
+     */
+    struct MaxProfit
+    {
+        using key_type = int;
+        static constexpr OrderKey order_key = OrderKey::MAX_PROFIT;
+
+        [[nodiscard]] static constexpr key_type key(const DCKPInstance &inst, int item) noexcept
+        {
+            return inst.profits[item];
+        }
+    };
+
+    /**
+     * @brief Menor peso primeiro (chave inteira: peso negado)
+     */
+    struct MinWeight
+    {
+        using key_type = int;
+        static constexpr OrderKey order_key = OrderKey::MIN_WEIGHT;
+
+        [[nodiscard]] static constexpr key_type key(const DCKPInstance &inst, int item) noexcept
+        {
+            return -inst.weights[item];
+        }
+    };
+
+    /**
+     * @brief Maior razão valor/peso primeiro (chave em ponto flutuante)
+     */
+    struct MaxProfitWeight
+    {
+        using key_type = double;
+        static constexpr OrderKey order_key = OrderKey::MAX_PROFIT_WEIGHT;
+
+        [[nodiscard]] static constexpr key_type key(const DCKPInstance &inst, int item) noexcept
+        {
+            if (inst.weights[item] == 0)
+            {
+                return static_cast<double>(inst.profits[item]) * 1000.0;
+            }
+            return static_cast<double>(inst.profits[item]) /
+                   static_cast<double>(inst.weights[item]);
+        }
+    };
+
+    /**
+     * @brief Menor grau de conflito primeiro (chave inteira: grau negado)
+     */
+    struct MinConflicts
+    {
+        using key_type = int;
+        static constexpr OrderKey order_key = OrderKey::MIN_CONFLICTS;
+
+        [[nodiscard]] static constexpr key_type key(const DCKPInstance &inst, int item) noexcept
+        {
+            return -static_cast<int>(inst.conflict_graph[item].size());
+        }
+    };
+
+    /**
+     * @brief Razão valor/peso multiplicada por 1 / (1 + 0.1 * grau)
+     *
+     * É o score do GRASP para um candidato viável: a parcela de conflitos
+     * com itens já selecionados é sempre zero para candidatos viáveis.
+     */
+    struct PenalizedRatio
+    {
+        using key_type = double;
+        static constexpr OrderKey order_key = OrderKey::PENALIZED_RATIO;
+
+        [[nodiscard]] static constexpr key_type key(const DCKPInstance &inst, int item) noexcept
+        {
+            const double degree = static_cast<double>(inst.conflict_graph[item].size());
+            return MaxProfitWeight::key(inst, item) * (1.0 / (1.0 + 0.1 * degree));
+        }
+    };
+
+    /**
+     * @brief Indica se a política usa chave inteira
+     */
+    template <typename Policy>
+    inline constexpr bool has_integral_key = std::is_integral_v<typename Policy::key_type>;
+
+    /**
+     * @brief Representação ordenável de (chave, item) para uma política
+     *
+     * Chaves inteiras usam o uint64 empacotado de sorting::packDescending
+     * (aceita radix sort); chaves reais usam par (chave, item) com comparador.
+     * Em ambos os casos: maior chave primeiro, menor índice no empate.
+     */
+    template <typename Policy, bool Integral = has_integral_key<Policy>>
+    struct SortEntry
+    {
+        using Entry = std::uint64_t;
+
+        [[nodiscard]] static Entry make(const DCKPInstance &inst, int item) noexcept
+        {
+            return sorting::packDescending(Policy::key(inst, item), item);
+        }
+
+        [[nodiscard]] static int item(Entry e) noexcept
+        {
+            return sorting::unpackItem(e);
+        }
+
+        [[nodiscard]] static bool before(Entry a, Entry b) noexcept
+        {
+            return a < b;
+        }
+    };
+
+    template <typename Policy>
+    struct SortEntry<Policy, false>
+    {
+        struct Entry
+        {
+            typename Policy::key_type key;
+            int item_id;
+        };
+
+        [[nodiscard]] static Entry make(const DCKPInstance &inst, int item) noexcept
+        {
+            return {Policy::key(inst, item), item};
+        }
+
+        [[nodiscard]] static int item(const Entry &e) noexcept
+        {
+            return e.item_id;
+        }
+
+        [[nodiscard]] static bool before(const Entry &a, const Entry &b) noexcept
+        {
+            return a.key > b.key || (a.key == b.key && a.item_id < b.item_id);
+        }
+    };
+
+} // namespace greedy_policy
+
+#endif // GREEDY_POLICIES_H
@@ -0,0 +1,91 @@
+/**
+ * @file item_order_cache.cpp
+ * @brief Implementação da classe ItemOrderCache
+ */
+
+#include "item_order_cache.h"
+
+#include "../utils/sorting.h"
+
+#include <algorithm>
+#include <cstddef>
+
+ItemOrderCache::ItemOrderCache(const DCKPInstance &inst) noexcept
+    : instance_(inst)
+{
+    for (auto &flag : ready_)
+    {
+        flag.store(false, std::memory_order_relaxed);
+    }
+}
+
+template <typename Policy>
+std::vector<int> ItemOrderCache::buildOrder(bool use_radix) const
+{
+    using Traits = greedy_policy::SortEntry<Policy>;
+
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+    std::vector<typename Traits::Entry> entries(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        entries[i] = Traits::make(instance_, static_cast<int>(i));
+    }
+
+    if constexpr (greedy_policy::has_integral_key<Policy>)
+    {
+        if (use_radix)
+        {
+            sorting::radixSortHigh32(entries);
+        }
+        else
+        {
+            std::ranges::sort(entries, Traits::before);
+        }
+    }
+    else
+    {
+        std::ranges::sort(entries, Traits::before);
+    }
+
+    std::vector<int> result(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result[i] = Traits::item(entries[i]);
+    }
+    return result;
+}
+
+const std::vector<int> &ItemOrderCache::order(OrderKey key, SortMode mode)
+{
+    const auto index = static_cast<std::size_t>(key);
+    const bool use_radix = (mode != SortMode::COMPARISON);
+
+    std::call_once(built_once_[index], [&]
+                   {
+                       switch (key)
+                       {
+                       case OrderKey::MAX_PROFIT:
+                           orders_[index] = buildOrder<greedy_policy::MaxProfit>(use_radix);
+                           break;
+                       case OrderKey::MIN_WEIGHT:
+                           orders_[index] = buildOrder<greedy_policy::MinWeight>(use_radix);
+                           break;
+                       case OrderKey::MAX_PROFIT_WEIGHT:
+                           orders_[index] = buildOrder<greedy_policy::MaxProfitWeight>(use_radix);
+                           break;
+                       case OrderKey::MIN_CONFLICTS:
+                           orders_[index] = buildOrder<greedy_policy::MinConflicts>(use_radix);
+                           break;
+                       case OrderKey::PENALIZED_RATIO:
+                           orders_[index] = buildOrder<greedy_policy::PenalizedRatio>(use_radix);
+                           break;
+                       }
+                       ready_[index].store(true, std::memory_order_release); });
+
+    return orders_[index];
+}
+
+bool ItemOrderCache::contains(OrderKey key) const noexcept
+{
+    return ready_[static_cast<std::size_t>(key)].load(std::memory_order_acquire);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file item_order_cache.h
+ * @brief Cache por instância de ordenações de itens pré-calculadas
+ *
+ * Guloso e GRASP percorrem os itens em ordem decrescente de alguma chave
+ * estática. Esta classe calcula cada ordenação uma única vez por instância
+ * e a compartilha entre todos os métodos construtivos.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef ITEM_ORDER_CACHE_H
+#define ITEM_ORDER_CACHE_H
+
+#include "../utils/instance_reader.h"
+#include "greedy_policies.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/**
+ * @enum SortMode
+ * @brief Algoritmo de ordenação usado pelas estratégias baseadas em ordem
+ */
+enum class SortMode
+{
+    AUTO,       ///< Escolhe pelo tamanho da instância e tipo da chave
+    COMPARISON, ///< Ordenação por comparação completa (std::sort)
+    RADIX,      ///< LSD radix sort (apenas chaves inteiras)
+    PARTIAL     ///< Ordena blocos crescentes sob demanda (nth_element + sort)
+};
+
+/**
+ * @class ItemOrderCache
+ * @brief Ordenações de itens construídas sob demanda e reutilizadas
+ *
+ * Cada OrderKey é ordenada no primeiro acesso (std::call_once) e mantida
+ * até a destruição do cache. Acessos concorrentes são seguros.
+ *
+ * @note A instância deve sobreviver ao cache.
+ */
+class ItemOrderCache
+{
+public:
+    /**
+     * @brief Construtor
+     * @param inst Referência para a instância do problema
+     */
+    explicit ItemOrderCache(const DCKPInstance &inst) noexcept;
+
+    /**
+     * @brief Retorna a ordenação de uma chave, construindo-a se necessário
+     * @param key Ordenação desejada
+     * @param mode Algoritmo usado caso a ordenação ainda não exista
+     *             (RADIX só vale para chaves inteiras; AUTO e PARTIAL usam
+     *             radix para chaves inteiras e comparação para reais)
+     * @return Itens em ordem decrescente de chave, menor índice no empate
+     */
+    [[nodiscard]] const std::vector<int> &order(OrderKey key, SortMode mode = SortMode::AUTO);
+
+    /**
+     * @brief Verifica se uma ordenação já foi construída
+     * @param key Ordenação consultada
+     * @return true se order(key) não precisará ordenar
+     */
+    [[nodiscard]] bool contains(OrderKey key) const noexcept;
+
+private:
+    const DCKPInstance &instance_;                                  ///< Referência para a instância
+    std::array<std::vector<int>, ORDER_KEY_COUNT> orders_;          ///< Ordenações por chave
+    std::array<std::once_flag, ORDER_KEY_COUNT> built_once_;        ///< Construção única por chave
+    std::array<std::atomic<bool>, ORDER_KEY_COUNT> ready_;          ///< Ordenação disponível
+
+    /**
+     * @brief Ordena os itens pela chave de uma política
+     * @tparam Policy Política de greedy_policy
+     * @param use_radix true para radix sort (ignorado em chaves reais)
+     * @return Itens ordenados
+     */
+    template <typename Policy>
+    [[nodiscard]] std::vector<int> buildOrder(bool use_radix) const;
+};
+
+#endif // ITEM_ORDER_CACHE_H
@@ -0,0 +1,163 @@
+/**
+ * @file path_relinking.cpp
+ * @brief Implementação do path relinking para o DCKP
+ */
+
+#include "path_relinking.h"
+
+#include <cstddef>
+#include <limits>
+
+PathRelinking::PathRelinking(const DCKPInstance &inst) noexcept
+    : instance_(inst) {}
+
+std::optional<Solution> PathRelinking::relink(const Solution &start, const Solution &guide)
+{
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+
+    in_.assign(n, 0);
+    in_guide_.assign(n, 0);
+    for (int item : start.selected_items)
+    {
+        in_[static_cast<std::size_t>(item)] = 1;
+    }
+    for (int item : guide.selected_items)
+    {
+        in_guide_[static_cast<std::size_t>(item)] = 1;
+    }
+
+    to_add_.clear();
+    to_drop_.clear();
+    for (int item : guide.selected_items)
+    {
+        if (!in_[static_cast<std::size_t>(item)])
+        {
+            to_add_.push_back(item);
+        }
+    }
+    for (int item : start.selected_items)
+    {
+        if (!in_guide_[static_cast<std::size_t>(item)])
+        {
+            to_drop_.push_back(item);
+        }
+    }
+
+    int profit = start.total_profit;
+    int weight = start.total_weight;
+    int best_profit = std::numeric_limits<int>::min();
+
+    while (!to_add_.empty() || !to_drop_.empty())
+    {
+        // Melhor movimento pelo lucro resultante; remoções primeiro, menor posição no empate
+        int move_profit = std::numeric_limits<int>::min();
+        std::size_t move_pos = 0;
+        bool move_is_add = false;
+
+        for (std::size_t k = 0; k < to_drop_.size(); ++k)
+        {
+            const int p = profit - instance_.profits[to_drop_[k]];
+            if (p > move_profit)
+            {
+                move_profit = p;
+                move_pos = k;
+            }
+        }
+
+        for (std::size_t k = 0; k < to_add_.size(); ++k)
+        {
+            const int item = to_add_[k];
+            int p = profit + instance_.profits[item];
+            int w = weight + instance_.weights[item];
+            for (int neighbor : instance_.conflict_graph[item])
+            {
+                if (in_[static_cast<std::size_t>(neighbor)])
+                {
+                    p -= instance_.profits[neighbor];
+                    w -= instance_.weights[neighbor];
+                }
+            }
+            if (w <= instance_.capacity && p > move_profit)
+            {
+                move_profit = p;
+                move_pos = k;
+                move_is_add = true;
+            }
+        }
+
+        // Sempre existe movimento: sem remoções pendentes, a solução corrente
+        // é subconjunto da guia e qualquer inserção restante é viável
+        if (move_is_add)
+        {
+            const int item = to_add_[move_pos];
+            for (int neighbor : instance_.conflict_graph[item])
+            {
+                auto &flag = in_[static_cast<std::size_t>(neighbor)];
+                if (flag)
+                {
+                    flag = 0;
+                    profit -= instance_.profits[neighbor];
+                    weight -= instance_.weights[neighbor];
+                }
+            }
+            in_[static_cast<std::size_t>(item)] = 1;
+            profit += instance_.profits[item];
+            weight += instance_.weights[item];
+
+            to_add_[move_pos] = to_add_.back();
+            to_add_.pop_back();
+            std::erase_if(to_drop_, [this](int x)
+                          { return !in_[static_cast<std::size_t>(x)]; });
+        }
+        else
+        {
+            const int item = to_drop_[move_pos];
+            in_[static_cast<std::size_t>(item)] = 0;
+            profit -= instance_.profits[item];
+            weight -= instance_.weights[item];
+
+            to_drop_[move_pos] = to_drop_.back();
+            to_drop_.pop_back();
+        }
+
+        const bool intermediate = !to_add_.empty() || !to_drop_.empty();
+        if (intermediate && profit > best_profit)
+        {
+            best_profit = profit;
+            best_in_ = in_;
+        }
+    }
+
+    if (best_profit == std::numeric_limits<int>::min())
+    {
+        return std::nullopt;
+    }
+
+    Solution result;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (best_in_[i])
+        {
+            const int item = static_cast<int>(i);
+            result.addItem(item, instance_.profits[item], instance_.weights[item]);
+        }
+    }
+    result.is_feasible = true;
+    return result;
+}
+
+std::string_view PathRelinking::modeToString(PathRelinkingMode mode) noexcept
+{
+    switch (mode)
+    {
+    case PathRelinkingMode::NONE:
+        return "None";
+    case PathRelinkingMode::FORWARD:
+        return "Forward";
+    case PathRelinkingMode::BACKWARD:
+        return "Backward";
+    case PathRelinkingMode::BACK_AND_FORWARD:
+        return "BackAndForward";
+    }
+    return "Unknown";
+}
@@ -0,0 +1,82 @@
+/**
+ * @file path_relinking.h
+ * @brief Path relinking entre soluções do DCKP
+ *
+ * Percorre o caminho de uma solução inicial até uma solução guia, aplicando a
+ * cada passo o melhor movimento entre os itens em que as duas diferem, e
+ * devolve a melhor solução intermediária visitada.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef PATH_RELINKING_H
+#define PATH_RELINKING_H
+
+#include "../utils/instance_reader.h"
+#include "../utils/solution.h"
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ * @enum PathRelinkingMode
+ * @brief Direção do path relinking no GRASP
+ */
+enum class PathRelinkingMode
+{
+    NONE,            ///< Sem path relinking (reinícios independentes)
+    FORWARD,         ///< Da construção até um membro elite
+    BACKWARD,        ///< De um membro elite até a construção
+    BACK_AND_FORWARD ///< As duas direções, fica a melhor
+};
+
+/**
+ * @class PathRelinking
+ * @brief Path relinking guloso com buffers reaproveitados entre chamadas
+ *
+ * Movimentos, sempre mantendo a viabilidade:
+ *   - Remover um item que está só na origem;
+ *   - Inserir um item que está só na guia, removendo junto os seus vizinhos
+ *     de conflito (todos só na origem, pois a guia é viável), desde que o
+ *     resultado caiba na mochila.
+ * A cada passo é aplicado o movimento de maior lucro resultante; um passo
+ * custa O(|diferença| · grau).
+ */
+class PathRelinking
+{
+public:
+    /**
+     * @brief Construtor
+     * @param inst Referência para a instância do DCKP
+     */
+    explicit PathRelinking(const DCKPInstance &inst) noexcept;
+
+    /**
+     * @brief Caminha de start até guide
+     * @param start Solução inicial (viável)
+     * @param guide Solução guia (viável)
+     * @return Melhor solução intermediária (exclui as extremidades), ou
+     *         std::nullopt se o caminho não tem soluções intermediárias
+     */
+    [[nodiscard]] std::optional<Solution> relink(const Solution &start, const Solution &guide);
+
+    /**
+     * @brief Converte PathRelinkingMode para string
+     * @param mode Direção
+     * @return Nome curto ("None", "Forward", "Backward", "BackAndForward")
+     */
+    [[nodiscard]] static std::string_view modeToString(PathRelinkingMode mode) noexcept;
+
+private:
+    const DCKPInstance &instance_; ///< Referência para a instância
+
+    std::vector<char> in_;        ///< Buffer: pertinência do item na solução corrente
+    std::vector<char> in_guide_;  ///< Buffer: pertinência do item na guia
+    std::vector<int> to_add_;     ///< Buffer: itens só na guia, ainda não inseridos
+    std::vector<int> to_drop_;    ///< Buffer: itens só na origem, ainda presentes
+    std::vector<char> best_in_;   ///< Buffer: pertinência da melhor intermediária
+};
+
+#endif // PATH_RELINKING_H
@@ -5,144 +5,125 @@
 
 #include "hill_climbing.h"
 
-#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
-#include <vector>
 
 HillClimbing::HillClimbing(const DCKPInstance &inst) noexcept
-    : instance_(inst), validator_(inst) {}
+    : pivot_rule_(PivotRule::BEST_IMPROVEMENT), moves_(inst) {}
 
-std::vector<Solution> HillClimbing::generateSwapNeighborhood(const Solution &current_sol) const
+std::optional<Move> HillClimbing::findBestMove()
 {
-    std::vector<Solution> neighborhood;
-
-    // Converte para vetores para acesso indexado eficiente
-    std::vector<int> in_solution(current_sol.selected_items.begin(),
-                                 current_sol.selected_items.end());
-
-    std::vector<int> out_solution;
-    out_solution.reserve(static_cast<std::size_t>(instance_.n_items) - in_solution.size());
-    for (int i = 0; i < instance_.n_items; ++i)
-    {
-        if (!current_sol.hasItem(i))
-        {
-            out_solution.push_back(i);
-        }
-    }
+    return moves_.bestSwap11();
+}
 
-    // Estima tamanho da vizinhança para pré-alocação
-    neighborhood.reserve(in_solution.size() * out_solution.size() / 4);
+Solution HillClimbing::solve(const Solution &initial_solution, int max_iterations,
+                             const Deadline &deadline)
+{
+    const auto start = std::chrono::steady_clock::now();
 
-    // Gera todos os movimentos Swap(1-1) viáveis
-    for (int item_out : in_solution)
+    Solution current_sol = initial_solution;
+    current_sol.method_name = "HillClimbing";
+    if (pivot_rule_ != PivotRule::BEST_IMPROVEMENT)
     {
-        const int weight_freed = instance_.weights[item_out];
-        const int profit_lost = instance_.profits[item_out];
-
-        for (int item_in : out_solution)
-        {
-            // Verifica capacidade
-            const int new_weight = current_sol.total_weight - weight_freed + instance_.weights[item_in];
-            if (new_weight > instance_.capacity)
-            {
-                continue;
-            }
-
-            // Verifica conflitos: item_in não pode conflitar com itens restantes
-            bool has_conflict = false;
-            for (int remaining : current_sol.selected_items)
-            {
-                if (remaining == item_out)
-                {
-                    continue;
-                }
-                if (instance_.hasConflict(item_in, remaining))
-                {
-                    has_conflict = true;
-                    break;
-                }
-            }
-
-            if (has_conflict)
-            {
-                continue;
-            }
-
-            // Constrói a solução vizinha
-            Solution neighbor = current_sol;
-            neighbor.removeItem(item_out, profit_lost, weight_freed);
-            neighbor.addItem(item_in, instance_.profits[item_in], instance_.weights[item_in]);
-            neighbor.is_feasible = true;
-
-            neighborhood.push_back(std::move(neighbor));
-        }
+        current_sol.method_name += '_';
+        current_sol.method_name += MoveEngine::pivotRuleToString(pivot_rule_);
     }
+    improve(current_sol, max_iterations, deadline);
 
-    return neighborhood;
-}
+    const auto end = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = end - start;
+    current_sol.computation_time = elapsed.count();
 
-std::optional<Solution> HillClimbing::findBestNeighbor(
-    const Solution &current_sol,
-    const std::vector<Solution> &neighborhood) const
-{
-    const Solution *best = nullptr;
+    const double rate = (current_sol.computation_time > 0.0)
+                            ? static_cast<double>(stats_.evaluations) / current_sol.computation_time
+                            : 0.0;
 
-    for (const auto &neighbor : neighborhood)
+    std::cout << "HillClimbing";
+    if (pivot_rule_ != PivotRule::BEST_IMPROVEMENT)
     {
-        if (neighbor.total_profit > current_sol.total_profit)
-        {
-            if (!best || neighbor.total_profit > best->total_profit)
-            {
-                best = &neighbor;
-            }
-        }
+        std::cout << " (" << MoveEngine::pivotRuleToString(pivot_rule_) << ')';
     }
-
-    if (best != nullptr)
+    std::cout << ": "
+              << "Valor = " << current_sol.total_profit
+              << ", Iteracoes = " << stats_.iterations
+              << ", Melhorias = " << stats_.improvements
+              << ", Avaliacoes = " << stats_.evaluations
+              << " (" << std::scientific << std::setprecision(2) << rate << "/s)"
+              << ", Podados = " << stats_.pruned
+              << ", Tempo = " << std::fixed << std::setprecision(4)
+              << current_sol.computation_time << "s";
+    if (stats_.time_limit_reached)
     {
-        return *best;
+        std::cout << " [limite de tempo]";
     }
-    return std::nullopt;
+    std::cout << '\n';
+
+    return current_sol;
 }
 
-Solution HillClimbing::solve(const Solution &initial_solution, int max_iterations)
+void HillClimbing::improve(Solution &current_sol, int max_iterations, const Deadline &deadline)
 {
-    const auto start = std::chrono::steady_clock::now();
-
-    Solution current_sol = initial_solution;
-    current_sol.method_name = "HillClimbing";
+    stats_ = LocalSearchStats{};
+    moves_.resetEvaluations();
+    moves_.load(current_sol);
+    moves_.setDeadline(&deadline);
 
     int iteration = 0;
     int improvements = 0;
 
     while (iteration < max_iterations)
     {
-        auto neighborhood = generateSwapNeighborhood(current_sol);
-        auto best_neighbor = findBestNeighbor(current_sol, neighborhood);
+        if (deadline.expired())
+        {
+            stats_.time_limit_reached = true;
+            break;
+        }
 
-        if (!best_neighbor.has_value())
+        const std::optional<Move> best_move = findBestMove();
+
+        if (!best_move)
         {
-            // Ótimo local atingido
+            // Ótimo local atingido, ou varredura interrompida pelo Deadline
+            stats_.time_limit_reached = deadline.expired();
             break;
         }
 
-        current_sol = std::move(best_neighbor.value());
+        moves_.apply(current_sol, *best_move);
         ++improvements;
         ++iteration;
     }
 
-    const auto end = std::chrono::steady_clock::now();
-    const std::chrono::duration<double> elapsed = end - start;
-    current_sol.computation_time = elapsed.count();
+    moves_.setDeadline(nullptr);
+    stats_.iterations = iteration;
+    stats_.improvements = improvements;
+    stats_.evaluations = moves_.evaluations();
+    stats_.pruned = moves_.pruned();
+}
 
-    std::cout << "HillClimbing: "
-              << "Valor = " << current_sol.total_profit
-              << ", Iteracoes = " << iteration
-              << ", Melhorias = " << improvements
-              << ", Tempo = " << std::fixed << std::setprecision(4)
-              << current_sol.computation_time << "s\n";
+const LocalSearchStats &HillClimbing::lastStats() const noexcept
+{
+    return stats_;
+}
 
-    return current_sol;
+void HillClimbing::setPivotRule(PivotRule rule) noexcept
+{
+    pivot_rule_ = rule;
+    moves_.setPivotRule(rule);
+}
+
+void HillClimbing::setSeed(std::uint64_t seed) noexcept
+{
+    moves_.setSeed(seed);
+}
+
+void HillClimbing::setParallel(bool enabled, unsigned int n_threads)
+{
+    moves_.setThreadPool(nullptr);
+    pool_.reset();
+    if (enabled)
+    {
+        pool_ = std::make_unique<ThreadPool>(n_threads);
+        moves_.setThreadPool(pool_.get());
+    }
 }
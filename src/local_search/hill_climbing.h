@@ -4,7 +4,8 @@
  *
  * Implementa uma busca local de subida mais íngreme usando vizinhança Swap(1-1).
  * O algoritmo explora exaustivamente a vizinhança e move-se para o melhor
- * vizinho até atingir um ótimo local.
+ * vizinho até atingir um ótimo local. Com PivotRule de first improvement,
+ * move-se para o primeiro vizinho que melhora.
  *
  * @author Thalles e Luiz
  * @version 2.0
@@ -13,12 +14,15 @@
 #ifndef HILL_CLIMBING_H
 #define HILL_CLIMBING_H
 
+#include "../utils/deadline.h"
 #include "../utils/instance_reader.h"
 #include "../utils/solution.h"
-#include "../utils/validator.h"
+#include "local_search_stats.h"
+#include "move_engine.h"
 
+#include <cstdint>
+#include <memory>
 #include <optional>
-#include <vector>
 
 /**
  * @class HillClimbing
@@ -41,35 +45,71 @@ public:
      *
      * @param initial_solution Solução inicial (tipicamente de um construtivo)
      * @param max_iterations Número máximo de iterações sem melhoria (default: 100)
+     * @param deadline Limite de tempo; consultado a cada iteração e dentro das varreduras
      * @return Melhor solução encontrada (ótimo local)
      */
-    [[nodiscard]] Solution solve(const Solution &initial_solution, int max_iterations = 100);
+    [[nodiscard]] Solution solve(const Solution &initial_solution, int max_iterations = 100,
+                                 const Deadline &deadline = Deadline());
 
-private:
-    const DCKPInstance &instance_; ///< Referência para a instância
-    Validator validator_;          ///< Validador de soluções
+    /**
+     * @brief Aplica a busca sobre uma solução, sem imprimir resumo
+     *
+     * Usado quando a busca roda muitas vezes (ex.: GRASP + busca local):
+     * os buffers internos do MoveEngine são reaproveitados entre chamadas.
+     *
+     * @param current_sol Solução melhorada no lugar
+     * @param max_iterations Número máximo de iterações
+     * @param deadline Limite de tempo; consultado a cada iteração e dentro das varreduras
+     */
+    void improve(Solution &current_sol, int max_iterations = 100,
+                 const Deadline &deadline = Deadline());
 
     /**
-     * @brief Gera a vizinhança Swap(1-1)
+     * @brief Estatísticas da última chamada de solve()
+     * @return Iterações, melhorias e indicação de parada por tempo
+     * @note Válido após solve() ou improve()
+     */
+    [[nodiscard]] const LocalSearchStats &lastStats() const noexcept;
+
+    /**
+     * @brief Define a regra de escolha do movimento (default: BEST_IMPROVEMENT)
+     * @param rule Regra de escolha
+     */
+    void setPivotRule(PivotRule rule) noexcept;
+
+    /**
+     * @brief Reinicia o gerador da ordem aleatória (SHUFFLED_FIRST_IMPROVEMENT)
+     * @param seed Semente
+     */
+    void setSeed(std::uint64_t seed) noexcept;
+
+    /**
+     * @brief Ativa a avaliação paralela das vizinhanças Swap
      *
-     * Para cada item i na solução, tenta trocar com cada item j
-     * fora da solução. Apenas trocas viáveis são incluídas.
+     * O laço externo da vizinhança é dividido entre as threads de um pool
+     * próprio; o movimento escolhido é o mesmo da execução sequencial.
      *
-     * @param current_sol Solução atual
-     * @return Vetor de soluções vizinhas viáveis
+     * @param enabled true para ativar
+     * @param n_threads Número de threads (0 = núcleos disponíveis)
      */
-    [[nodiscard]] std::vector<Solution> generateSwapNeighborhood(const Solution &current_sol) const;
+    void setParallel(bool enabled, unsigned int n_threads = 0);
+
+private:
+    LocalSearchStats stats_;           ///< Estatísticas da última execução
+    PivotRule pivot_rule_;             ///< Regra de escolha do movimento
+    std::unique_ptr<ThreadPool> pool_; ///< Pool da avaliação paralela (nullptr = sequencial)
+    MoveEngine moves_;                 ///< Avaliação da vizinhança por movimentos
 
     /**
-     * @brief Encontra o melhor vizinho (Best Improvement)
+     * @brief Encontra o melhor movimento Swap(1-1) (Best Improvement)
+     *
+     * Para cada item i na solução, avalia a troca com cada item j
+     * fora da solução. Apenas trocas viáveis são consideradas.
      *
-     * @param current_sol Solução atual para comparação
-     * @param neighborhood Vizinhança gerada
-     * @return Melhor vizinho que melhora, ou std::nullopt se nenhum melhora
+     * @return Melhor movimento que melhora sobre a solução carregada em
+     *         moves_, ou std::nullopt se nenhum melhora
      */
-    [[nodiscard]] std::optional<Solution> findBestNeighbor(
-        const Solution &current_sol,
-        const std::vector<Solution> &neighborhood) const;
+    [[nodiscard]] std::optional<Move> findBestMove();
 };
 
 #endif // HILL_CLIMBING_H
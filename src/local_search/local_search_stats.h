@@ -0,0 +1,26 @@
+/**
+ * @file local_search_stats.h
+ * @brief Estatísticas da última execução de uma busca local
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef LOCAL_SEARCH_STATS_H
+#define LOCAL_SEARCH_STATS_H
+
+/**
+ * @struct LocalSearchStats
+ * @brief Contadores preenchidos por HillClimbing::solve, VND::solve e TabuSearch::solve
+ */
+struct LocalSearchStats
+{
+    int iterations = 0;              ///< Iterações concluídas
+    int improvements = 0;            ///< Movimentos de melhoria aplicados
+    bool time_limit_reached = false; ///< Parou pelo Deadline
+    long long evaluations = 0;       ///< Movimentos avaliados
+    long long pruned = 0;            ///< Candidatos descartados sem avaliação
+    long long skipped = 0;           ///< Itens que saem pulados por don't-look bits
+};
+
+#endif // LOCAL_SEARCH_STATS_H
@@ -0,0 +1,34 @@
+/**
+ * @file move.h
+ * @brief Movimento de busca local avaliado por diferença
+ *
+ * Um movimento descreve a vizinha pela diferença em relação à solução
+ * corrente (itens que saem, itens que entram e a variação de lucro e peso),
+ * sem copiar a solução.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef MOVE_H
+#define MOVE_H
+
+#include <array>
+
+/**
+ * @struct Move
+ * @brief Movimento compacto: até MAX_ITEMS itens saem e até MAX_ITEMS entram
+ */
+struct Move
+{
+    static constexpr int MAX_ITEMS = 3; ///< Máximo de itens por lado (cadeias de ejeção de 3 elos)
+
+    std::array<int, MAX_ITEMS> out{}; ///< Itens removidos (os n_out primeiros)
+    std::array<int, MAX_ITEMS> in{};  ///< Itens inseridos (os n_in primeiros)
+    int n_out = 0;                    ///< Número de itens removidos
+    int n_in = 0;                     ///< Número de itens inseridos
+    int delta_profit = 0;             ///< Variação do lucro total
+    int delta_weight = 0;             ///< Variação do peso total
+};
+
+#endif // MOVE_H
@@ -0,0 +1,1262 @@
+/**
+ * @file move_engine.cpp
+ * @brief Implementação da avaliação de vizinhanças por movimentos
+ */
+
+#include "move_engine.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+MoveEngine::MoveEngine(const DCKPInstance &inst) noexcept
+    : instance_(inst) {}
+
+namespace
+{
+    /**
+     * @brief Resposta do visitante de forEachMerged
+     */
+    enum class Visit
+    {
+        NEXT, ///< Segue para o próximo candidato
+        DONE, ///< Nenhum candidato restante pode melhorar: encerra esta lista
+        STOP  ///< Movimento aceito: encerra a varredura
+    };
+
+    /**
+     * @brief Visita a união dos livres (cursor) e de uma lista na ordem de rank (lucro decrescente)
+     * @param visited Incrementado a cada candidato visitado
+     * @return true se f pediu Visit::STOP
+     */
+    template <typename Cursor, typename F>
+    bool forEachMerged(Cursor a, std::span<const int> b, const std::vector<int> &rank,
+                       long long &visited, F &&f)
+    {
+        std::size_t j = 0;
+        while (!a.done() || j < b.size())
+        {
+            const bool take_a = (j == b.size()) ||
+                                (!a.done() && rank[static_cast<std::size_t>(a.item())] <
+                                                  rank[static_cast<std::size_t>(b[j])]);
+            int item = 0;
+            if (take_a)
+            {
+                item = a.item();
+                a.next();
+            }
+            else
+            {
+                item = b[j++];
+            }
+            ++visited;
+            switch (f(item))
+            {
+            case Visit::NEXT:
+                break;
+            case Visit::DONE:
+                return false;
+            case Visit::STOP:
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Prefixo da união dos livres (cursor) e de uma lista em ordem de rank, materializado sob demanda
+     *
+     * Só cresce enquanto a varredura pede mais candidatos e nunca passa de
+     * limit itens: a poda por lucro costuma parar nos primeiros.
+     */
+    template <typename Cursor>
+    class MergedPrefix
+    {
+    public:
+        MergedPrefix(Cursor a, std::span<const int> b, const std::vector<int> &rank,
+                     std::size_t limit, std::vector<int> &items)
+            : a_(a), b_(b), rank_(rank), limit_(limit), items_(items)
+        {
+            items_.clear();
+        }
+
+        /**
+         * @brief Materializa até n itens
+         * @return Número de itens disponíveis (menor que n no fim da união ou no limite)
+         */
+        std::size_t fill(std::size_t n)
+        {
+            const std::size_t target = std::min(n, limit_);
+            while (items_.size() < target && (!a_.done() || j_ < b_.size()))
+            {
+                const bool take_a = (j_ == b_.size()) ||
+                                    (!a_.done() && rank_[static_cast<std::size_t>(a_.item())] <
+                                                       rank_[static_cast<std::size_t>(b_[j_])]);
+                if (take_a)
+                {
+                    items_.push_back(a_.item());
+                    a_.next();
+                }
+                else
+                {
+                    items_.push_back(b_[j_++]);
+                }
+            }
+            return items_.size();
+        }
+
+        [[nodiscard]] int operator[](std::size_t k) const noexcept
+        {
+            return items_[k];
+        }
+
+    private:
+        Cursor a_;
+        std::span<const int> b_;
+        const std::vector<int> &rank_;
+        std::size_t limit_;
+        std::vector<int> &items_;
+        std::size_t j_ = 0;
+    };
+
+    /**
+     * @brief Visita os pares de candidatos que superam best_delta (a antes de b na lista)
+     * @param freed_profit Lucro dos itens que saem
+     * @param residual Capacidade disponível para os dois itens
+     * @param sorted Candidatos em ordem de lucro (habilita a poda)
+     * @param on_move Chamado com (a, b, delta) a cada melhoria; true encerra a varredura
+     * @return true se on_move pediu para encerrar
+     */
+    template <typename Cursor, typename F>
+    bool forEachImprovingPair(MergedPrefix<Cursor> &candidates, const DCKPInstance &inst, int freed_profit,
+                              int residual, bool sorted, int &best_delta, long long &evaluated, F &&on_move)
+    {
+        for (std::size_t ia = 0; ia + 1 < candidates.fill(ia + 2); ++ia)
+        {
+            const int a = candidates[ia];
+            const int profit_a = inst.profits[a];
+            const int weight_a = inst.weights[a];
+
+            // Nem com o melhor parceiro restante o par supera o melhor ganho
+            if (sorted && profit_a + inst.profits[candidates[ia + 1]] - freed_profit <= best_delta)
+            {
+                break;
+            }
+            if (weight_a > residual)
+            {
+                continue;
+            }
+
+            for (std::size_t ib = ia + 1; ib < candidates.fill(ib + 1); ++ib)
+            {
+                const int b = candidates[ib];
+                ++evaluated;
+                const int delta = profit_a + inst.profits[b] - freed_profit;
+                if (delta <= best_delta)
+                {
+                    if (sorted)
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                if (weight_a + inst.weights[b] > residual || inst.hasConflict(a, b))
+                {
+                    continue;
+                }
+                best_delta = delta;
+                if (on_move(a, b, delta))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Posição de um item numa lista em ordem de rank (lower_bound)
+     */
+    std::vector<int>::iterator rankSlot(std::vector<int> &list, int item, const std::vector<int> &rank)
+    {
+        return std::ranges::lower_bound(list, rank[static_cast<std::size_t>(item)], {}, [&rank](int other)
+                                        { return rank[static_cast<std::size_t>(other)]; });
+    }
+
+    /**
+     * @brief Posição de (parceiro, item) numa lista em ordem de posição do parceiro e rank (lower_bound)
+     */
+    std::vector<std::pair<int, int>>::iterator pairSlot(std::vector<std::pair<int, int>> &list, int partner, int item,
+                                                         const std::vector<int> &position, const std::vector<int> &rank)
+    {
+        auto key = [&](int p, int i)
+        { return std::pair{position[static_cast<std::size_t>(p)], rank[static_cast<std::size_t>(i)]}; };
+        return std::ranges::lower_bound(list, key(partner, item), {}, [&](const std::pair<int, int> &entry)
+                                        { return key(entry.first, entry.second); });
+    }
+} // namespace
+
+void MoveEngine::load(const Solution &solution)
+{
+    rebuild(solution);
+    clearDontLookBits();
+}
+
+void MoveEngine::rebuild(const Solution &solution)
+{
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+
+    if (by_profit_.size() != n)
+    {
+        buildProfitOrder();
+    }
+
+    in_items_.assign(solution.selected_items.begin(), solution.selected_items.end());
+    if (rule_ == PivotRule::SHUFFLED_FIRST_IMPROVEMENT)
+    {
+        shuffle(in_items_);
+    }
+
+    in_.assign(n, 0);
+    position_.assign(n, -1);
+    conflicts_.assign(n, 0);
+    conflict_sum_.assign(n, 0);
+    conflict_sq_sum_.assign(n, 0);
+    for (std::size_t p = 0; p < in_items_.size(); ++p)
+    {
+        const int item = in_items_[p];
+        in_[static_cast<std::size_t>(item)] = 1;
+        position_[static_cast<std::size_t>(item)] = static_cast<int>(p);
+        for (int neighbor : instance_.conflict_graph[item])
+        {
+            ++conflicts_[static_cast<std::size_t>(neighbor)];
+            conflict_sum_[static_cast<std::size_t>(neighbor)] += item;
+            conflict_sq_sum_[static_cast<std::size_t>(neighbor)] += static_cast<std::int64_t>(item) * item;
+        }
+    }
+
+    // Livres em ordem de lucro; embaralhados, na ordem aleatória desta carga
+    scan_order_ = by_profit_;
+    if (rule_ == PivotRule::SHUFFLED_FIRST_IMPROVEMENT)
+    {
+        shuffle(scan_order_);
+    }
+    scan_rank_.resize(n);
+    for (std::size_t r = 0; r < n; ++r)
+    {
+        scan_rank_[static_cast<std::size_t>(scan_order_[r])] = static_cast<int>(r);
+    }
+
+    weight_ = solution.total_weight;
+    buildCandidateLists();
+}
+
+void MoveEngine::buildProfitOrder()
+{
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+
+    // Lucro decrescente, índice crescente no empate: o primeiro de maior
+    // ganho continua sendo o de menor índice, como na enumeração por índice
+    by_profit_.resize(n);
+    std::iota(by_profit_.begin(), by_profit_.end(), 0);
+    std::ranges::stable_sort(by_profit_, std::greater<>{}, [this](int item)
+                             { return instance_.profits[item]; });
+
+    profit_rank_.resize(n);
+    for (std::size_t r = 0; r < n; ++r)
+    {
+        profit_rank_[static_cast<std::size_t>(by_profit_[r])] = static_cast<int>(r);
+    }
+}
+
+void MoveEngine::buildCandidateLists()
+{
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+
+    std::vector<int> free_weights(n, MinSegmentTree::EMPTY);
+    free_count_ = 0;
+    bound_count_ = 0;
+    pair_count_ = 0;
+    bound_lists_.resize(n);
+    pair_lists_.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        bound_lists_[i].clear();
+        pair_lists_[i].clear();
+    }
+
+    // Preenchimento em ordem de lucro: cada lista já sai ordenada
+    for (const int item : by_profit_)
+    {
+        const auto i = static_cast<std::size_t>(item);
+        if (in_[i])
+        {
+            continue;
+        }
+        switch (conflicts_[i])
+        {
+        case 0:
+            free_weights[static_cast<std::size_t>(scan_rank_[i])] = instance_.weights[i];
+            ++free_count_;
+            break;
+        case 1:
+            bound_lists_[static_cast<std::size_t>(conflict_sum_[i])].push_back(item);
+            ++bound_count_;
+            break;
+        case 2:
+        {
+            const auto [first, second] = pairPartners(i);
+            pair_lists_[static_cast<std::size_t>(first)].emplace_back(second, item);
+            ++pair_count_;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // Pares de cada item ordenados pela posição do segundo parceiro (estável: mantém o lucro)
+    for (const int item : in_items_)
+    {
+        std::ranges::stable_sort(pair_lists_[static_cast<std::size_t>(item)], {}, [this](const std::pair<int, int> &entry)
+                                 { return position_[static_cast<std::size_t>(entry.first)]; });
+    }
+
+    free_tree_.assign(free_weights);
+}
+
+std::pair<int, int> MoveEngine::pairPartners(std::size_t item) const noexcept
+{
+    // Com S = a + b e Q = a² + b², (b - a)² = 2Q - S²
+    const std::int64_t sum = conflict_sum_[item];
+    const auto gap = static_cast<std::int64_t>(
+        std::llround(std::sqrt(static_cast<double>(2 * conflict_sq_sum_[item] - sum * sum))));
+    const auto a = static_cast<int>((sum - gap) / 2);
+    const auto b = static_cast<int>((sum + gap) / 2);
+    return (position_[static_cast<std::size_t>(a)] < position_[static_cast<std::size_t>(b)]) ? std::pair{a, b}
+                                                                                              : std::pair{b, a};
+}
+
+void MoveEngine::attachCandidate(int item)
+{
+    const auto i = static_cast<std::size_t>(item);
+    switch (conflicts_[i])
+    {
+    case 0:
+        free_tree_.update(scan_rank_[i], instance_.weights[i]);
+        ++free_count_;
+        break;
+    case 1:
+    {
+        std::vector<int> &list = bound_lists_[static_cast<std::size_t>(conflict_sum_[i])];
+        list.insert(rankSlot(list, item, profit_rank_), item);
+        ++bound_count_;
+        break;
+    }
+    case 2:
+    {
+        const auto [first, second] = pairPartners(i);
+        std::vector<std::pair<int, int>> &list = pair_lists_[static_cast<std::size_t>(first)];
+        list.insert(pairSlot(list, second, item, position_, profit_rank_), {second, item});
+        ++pair_count_;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void MoveEngine::detachCandidate(int item) noexcept
+{
+    const auto i = static_cast<std::size_t>(item);
+    switch (conflicts_[i])
+    {
+    case 0:
+        free_tree_.update(scan_rank_[i], MinSegmentTree::EMPTY);
+        --free_count_;
+        break;
+    case 1:
+    {
+        std::vector<int> &list = bound_lists_[static_cast<std::size_t>(conflict_sum_[i])];
+        list.erase(rankSlot(list, item, profit_rank_));
+        --bound_count_;
+        break;
+    }
+    case 2:
+    {
+        const auto [first, second] = pairPartners(i);
+        std::vector<std::pair<int, int>> &list = pair_lists_[static_cast<std::size_t>(first)];
+        list.erase(pairSlot(list, second, item, position_, profit_rank_));
+        --pair_count_;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void MoveEngine::insertSelected(int item)
+{
+    const auto i = static_cast<std::size_t>(item);
+    detachCandidate(item);
+    in_[i] = 1;
+    weight_ += instance_.weights[i];
+
+    // in_items_ continua crescente: as posições seguintes andam uma casa
+    const auto slot = std::ranges::lower_bound(in_items_, item);
+    const auto p = static_cast<std::size_t>(slot - in_items_.begin());
+    in_items_.insert(slot, item);
+    for (std::size_t q = p; q < in_items_.size(); ++q)
+    {
+        position_[static_cast<std::size_t>(in_items_[q])] = static_cast<int>(q);
+    }
+
+    for (int neighbor : instance_.conflict_graph[item])
+    {
+        const auto v = static_cast<std::size_t>(neighbor);
+        detachCandidate(neighbor);
+        ++conflicts_[v];
+        conflict_sum_[v] += item;
+        conflict_sq_sum_[v] += static_cast<std::int64_t>(item) * item;
+        attachCandidate(neighbor);
+    }
+}
+
+void MoveEngine::removeSelected(int item)
+{
+    const auto i = static_cast<std::size_t>(item);
+
+    // Antes de tirar o item: as chaves dos pares usam as posições atuais
+    for (int neighbor : instance_.conflict_graph[item])
+    {
+        const auto v = static_cast<std::size_t>(neighbor);
+        detachCandidate(neighbor);
+        --conflicts_[v];
+        conflict_sum_[v] -= item;
+        conflict_sq_sum_[v] -= static_cast<std::int64_t>(item) * item;
+        attachCandidate(neighbor);
+    }
+
+    in_[i] = 0;
+    weight_ -= instance_.weights[i];
+    const auto p = static_cast<std::size_t>(position_[i]);
+    in_items_.erase(in_items_.begin() + static_cast<std::ptrdiff_t>(p));
+    position_[i] = -1;
+    for (std::size_t q = p; q < in_items_.size(); ++q)
+    {
+        position_[static_cast<std::size_t>(in_items_[q])] = static_cast<int>(q);
+    }
+
+    // Sem conflitos com a solução (viável): volta como livre
+    attachCandidate(item);
+}
+
+MoveEngine::FreeCursor::FreeCursor(const MoveEngine &engine, int residual) noexcept
+    : engine_(engine), residual_(residual), position_(engine.free_tree_.findFirst(0, residual)) {}
+
+bool MoveEngine::FreeCursor::done() const noexcept
+{
+    return position_ < 0;
+}
+
+int MoveEngine::FreeCursor::item() const noexcept
+{
+    return engine_.scan_order_[static_cast<std::size_t>(position_)];
+}
+
+void MoveEngine::FreeCursor::next() noexcept
+{
+    position_ = engine_.free_tree_.findFirst(position_ + 1, residual_);
+}
+
+MoveEngine::FreeCursor MoveEngine::freeFitting(int residual) const noexcept
+{
+    return FreeCursor(*this, residual);
+}
+
+bool MoveEngine::sortedByProfit() const noexcept
+{
+    return rule_ != PivotRule::SHUFFLED_FIRST_IMPROVEMENT;
+}
+
+std::span<const int> MoveEngine::boundTo(std::size_t p) const noexcept
+{
+    return bound_lists_[static_cast<std::size_t>(in_items_[p])];
+}
+
+void MoveEngine::setPivotRule(PivotRule rule) noexcept
+{
+    rule_ = rule;
+}
+
+void MoveEngine::setSeed(std::uint64_t seed) noexcept
+{
+    rng_.seed(seed);
+}
+
+bool MoveEngine::stopsAtFirst() const noexcept
+{
+    return rule_ != PivotRule::BEST_IMPROVEMENT;
+}
+
+bool MoveEngine::interrupted(const std::atomic<bool> *cancel) const noexcept
+{
+    return (cancel != nullptr && cancel->load(std::memory_order_relaxed)) ||
+           (deadline_ != nullptr && deadline_->expired());
+}
+
+void MoveEngine::shuffle(std::vector<int> &items) noexcept
+{
+    for (std::size_t i = items.size(); i > 1; --i)
+    {
+        const auto j = static_cast<std::size_t>(prng::bounded(rng_, static_cast<std::uint32_t>(i)));
+        std::swap(items[i - 1], items[j]);
+    }
+}
+
+std::optional<Move> MoveEngine::bestAddDrop(const std::atomic<bool> *cancel) noexcept
+{
+    std::optional<Move> best;
+    int best_delta = 0;
+    long long evaluated = 0;
+
+    // ADD: qualquer item livre que caiba (em ordem de lucro, o primeiro que cabe é o melhor)
+    for (FreeCursor candidates = freeFitting(instance_.capacity - weight_); !candidates.done(); candidates.next())
+    {
+        ++evaluated;
+        const int item = candidates.item();
+        const int delta = instance_.profits[item];
+        if (delta <= best_delta)
+        {
+            if (sortedByProfit())
+            {
+                break;
+            }
+            continue;
+        }
+        // Em ordem de lucro é o melhor; embaralhado, é o primeiro (first improvement)
+        best_delta = delta;
+        best = Move{.in = {item}, .n_in = 1, .delta_profit = delta, .delta_weight = instance_.weights[item]};
+        break;
+    }
+    pruned_ += free_count_ - evaluated;
+    if ((best && stopsAtFirst()) || interrupted(cancel))
+    {
+        evaluations_ += evaluated;
+        return best;
+    }
+
+    // DROP: só melhora com lucro negativo
+    for (int item : in_items_)
+    {
+        ++evaluated;
+        const int delta = -instance_.profits[item];
+        if (delta > best_delta)
+        {
+            best_delta = delta;
+            best = Move{.out = {item}, .n_out = 1, .delta_profit = delta, .delta_weight = -instance_.weights[item]};
+            if (stopsAtFirst())
+            {
+                break;
+            }
+        }
+    }
+
+    evaluations_ += evaluated;
+    return best;
+}
+
+void MoveEngine::setThreadPool(ThreadPool *pool) noexcept
+{
+    pool_ = pool;
+}
+
+void MoveEngine::setDontLookBits(bool enabled) noexcept
+{
+    dont_look_ = enabled;
+}
+
+void MoveEngine::clearDontLookBits() noexcept
+{
+    const auto n = static_cast<std::size_t>(instance_.n_items);
+    quiet_swap11_.assign(n, 0);
+    quiet_swap21_.assign(n, 0);
+}
+
+void MoveEngine::setDeadline(const Deadline *deadline) noexcept
+{
+    deadline_ = deadline;
+}
+
+void MoveEngine::setDeferredMarks(bool enabled) noexcept
+{
+    defer_marks_ = enabled;
+    deferred_swap11_.clear();
+    deferred_swap21_.clear();
+}
+
+void MoveEngine::settleSwap11Marks(bool keep) noexcept
+{
+    settleMarks(deferred_swap11_, quiet_swap11_, keep);
+}
+
+void MoveEngine::settleSwap21Marks(bool keep) noexcept
+{
+    settleMarks(deferred_swap21_, quiet_swap21_, keep);
+}
+
+void MoveEngine::settleMarks(std::vector<int> &deferred, std::vector<char> &quiet, bool keep) noexcept
+{
+    if (keep)
+    {
+        for (int item : deferred)
+        {
+            quiet[static_cast<std::size_t>(item)] = 1;
+        }
+    }
+    deferred.clear();
+}
+
+void MoveEngine::wake(const Move &move) noexcept
+{
+    auto wakeItem = [this](int item)
+    {
+        quiet_swap11_[static_cast<std::size_t>(item)] = 0;
+        quiet_swap21_[static_cast<std::size_t>(item)] = 0;
+    };
+
+    // Só mudam os candidatos dos parceiros de vizinhos cuja contagem mudou;
+    // vizinhos com três ou mais conflitos não são candidatos de ninguém
+    auto wakeAround = [&](int moved)
+    {
+        wakeItem(moved);
+        for (int neighbor : instance_.conflict_graph[moved])
+        {
+            const auto v = static_cast<std::size_t>(neighbor);
+            if (in_[v])
+            {
+                continue;
+            }
+            if (conflicts_[v] == 1)
+            {
+                wakeItem(static_cast<int>(conflict_sum_[v]));
+            }
+            else if (conflicts_[v] == 2)
+            {
+                for (int partner : instance_.conflict_graph[v])
+                {
+                    if (in_[static_cast<std::size_t>(partner)])
+                    {
+                        wakeItem(partner);
+                    }
+                }
+            }
+        }
+    };
+
+    for (int k = 0; k < move.n_out; ++k)
+    {
+        wakeAround(move.out[static_cast<std::size_t>(k)]);
+    }
+    for (int k = 0; k < move.n_in; ++k)
+    {
+        wakeAround(move.in[static_cast<std::size_t>(k)]);
+    }
+}
+
+void MoveEngine::markFirstFound(ScanControl &control, std::size_t outer) noexcept
+{
+    std::size_t current = control.first_found.load(std::memory_order_relaxed);
+    while (outer < current &&
+           !control.first_found.compare_exchange_weak(current, outer, std::memory_order_relaxed))
+    {
+    }
+}
+
+template <typename Scan>
+std::optional<Move> MoveEngine::runScan(Scan scan, long long work, std::vector<char> *quiet,
+                                       std::vector<int> *deferred, const std::atomic<bool> *cancel)
+{
+    ScanControl control{in_items_.size(), cancel, deadline_};
+
+    // As faixas só leem os bits; a marcação acontece depois da varredura
+    auto collect = [&](const ScanResult &result)
+    {
+        evaluations_ += result.evaluated;
+        pruned_ += result.pruned;
+        skipped_ += result.skipped;
+        if (defer_marks_ && deferred != nullptr)
+        {
+            deferred->insert(deferred->end(), result.quiet.begin(), result.quiet.end());
+            return;
+        }
+        for (int item : result.quiet)
+        {
+            (*quiet)[static_cast<std::size_t>(item)] = 1;
+        }
+    };
+
+    if (pool_ == nullptr || pool_->size() < 2 || work < PARALLEL_MIN_EVALUATIONS)
+    {
+        ScanResult result = scan(0, 1, control);
+        collect(result);
+        return control.cancelled() ? std::nullopt : result.move;
+    }
+
+    const std::size_t n_tasks = pool_->size();
+    std::vector<std::future<ScanResult>> tasks;
+    tasks.reserve(n_tasks);
+    for (std::size_t t = 0; t < n_tasks; ++t)
+    {
+        tasks.push_back(pool_->submit([&scan, &control, t, n_tasks]
+                                      { return scan(t, n_tasks, control); }));
+    }
+
+    // Redução determinística: first improvement fica com o menor índice
+    // externo; best improvement com o maior ganho e o menor índice no empate
+    ScanResult best;
+    for (auto &task : tasks)
+    {
+        ScanResult result = task.get();
+        collect(result);
+        if (!result.move)
+        {
+            continue;
+        }
+        const bool better = !best.move ||
+                            (stopsAtFirst()
+                                 ? result.outer < best.outer
+                                 : (result.move->delta_profit > best.move->delta_profit ||
+                                    (result.move->delta_profit == best.move->delta_profit &&
+                                     result.outer < best.outer)));
+        if (better)
+        {
+            best.move = result.move;
+            best.outer = result.outer;
+        }
+    }
+    return control.cancelled() ? std::nullopt : best.move;
+}
+
+std::optional<Move> MoveEngine::bestSwap11(const std::atomic<bool> *cancel) noexcept
+{
+    const auto work = static_cast<long long>(in_items_.size()) * static_cast<long long>(free_count_) +
+                      static_cast<long long>(bound_count_);
+    return runScan([this](std::size_t first, std::size_t stride, ScanControl &control)
+                   { return scanSwap11(first, stride, control); },
+                   work, &quiet_swap11_, &deferred_swap11_, cancel);
+}
+
+std::optional<Move> MoveEngine::bestSwap21(const std::atomic<bool> *cancel) noexcept
+{
+    const auto n_in = static_cast<long long>(in_items_.size());
+    const long long work = n_in * (n_in - 1) / 2 * static_cast<long long>(free_count_) +
+                           n_in * static_cast<long long>(bound_count_ + pair_count_);
+    return runScan([this](std::size_t first, std::size_t stride, ScanControl &control)
+                   { return scanSwap21(first, stride, control); },
+                   work, &quiet_swap21_, &deferred_swap21_, cancel);
+}
+
+MoveEngine::ScanResult MoveEngine::scanSwap11(std::size_t first, std::size_t stride, ScanControl &control) noexcept
+{
+    ScanResult result;
+    int best_delta = 0;
+
+    for (std::size_t i = first; i < in_items_.size(); i += stride)
+    {
+        // Outra faixa já achou melhoria antes na ordem de enumeração
+        if ((stopsAtFirst() && i > control.first_found.load(std::memory_order_relaxed)) ||
+            control.cancelled())
+        {
+            break;
+        }
+
+        const int item_out = in_items_[i];
+        if (dont_look_ && quiet_swap11_[static_cast<std::size_t>(item_out)])
+        {
+            ++result.skipped;
+            continue;
+        }
+        const int profit_lost = instance_.profits[item_out];
+        const int residual = instance_.capacity - weight_ + instance_.weights[item_out];
+
+        // Candidatos: livres e os que só conflitam com item_out
+        const std::span<const int> bound = boundTo(i);
+        const long long visited_before = result.evaluated;
+        bool open = false; // Algum candidato visitado com ganho positivo: o item não é marcado
+        const bool stop = forEachMerged(freeFitting(residual), bound, profit_rank_, result.evaluated, [&](int item_in)
+                                        {
+            const int delta = instance_.profits[item_in] - profit_lost;
+            if (delta <= best_delta)
+            {
+                open = open || delta > 0;
+                return sortedByProfit() ? Visit::DONE : Visit::NEXT;
+            }
+            if (instance_.weights[item_in] > residual)
+            {
+                return Visit::NEXT;
+            }
+            open = true;
+            best_delta = delta;
+            result.outer = i;
+            result.move = Move{.out = {item_out}, .in = {item_in}, .n_out = 1, .n_in = 1,
+                               .delta_profit = delta,
+                               .delta_weight = instance_.weights[item_in] - instance_.weights[item_out]};
+            return stopsAtFirst() ? Visit::STOP : Visit::NEXT; });
+        result.pruned += static_cast<long long>(free_count_) + static_cast<long long>(bound.size()) -
+                         (result.evaluated - visited_before);
+        if (stop)
+        {
+            markFirstFound(control, i);
+            return result;
+        }
+        if (dont_look_ && !open)
+        {
+            result.quiet.push_back(item_out);
+        }
+    }
+
+    return result;
+}
+
+void MoveEngine::pairExtras(std::size_t i, std::size_t j, PairCursor &cursor, PairCursor end,
+                            std::vector<int> &extras, std::vector<int> &merged) const
+{
+    auto by_rank = [this](int item)
+    { return profit_rank_[static_cast<std::size_t>(item)]; };
+    auto partner_position = [this](PairCursor entry)
+    { return static_cast<std::size_t>(position_[static_cast<std::size_t>(entry->first)]); };
+
+    extras.clear();
+    std::ranges::merge(boundTo(i), boundTo(j), std::back_inserter(extras), {}, by_rank, by_rank);
+    while (cursor != end && partner_position(cursor) < j)
+    {
+        ++cursor;
+    }
+    if (cursor == end || partner_position(cursor) != j)
+    {
+        return;
+    }
+
+    // Itens cujos dois conflitos são exatamente (i, j), intercalados por lucro
+    merged.clear();
+    auto it = extras.begin();
+    for (; cursor != end && partner_position(cursor) == j; ++cursor)
+    {
+        for (; it != extras.end() && by_rank(*it) < by_rank(cursor->second); ++it)
+        {
+            merged.push_back(*it);
+        }
+        merged.push_back(cursor->second);
+    }
+    merged.insert(merged.end(), it, extras.end());
+    extras.swap(merged);
+}
+
+MoveEngine::ScanResult MoveEngine::scanSwap21(std::size_t first, std::size_t stride, ScanControl &control) noexcept
+{
+    ScanResult result;
+    int best_delta = 0;
+
+    std::vector<int> extras;
+    std::vector<int> merged;
+
+    const std::size_t n_in = in_items_.size();
+    for (std::size_t i = first; i < n_in; i += stride)
+    {
+        if ((stopsAtFirst() && i > control.first_found.load(std::memory_order_relaxed)) ||
+            control.cancelled())
+        {
+            break;
+        }
+
+        // Par pulado só se os dois itens estão marcados: um item desmarcado
+        // (recém-inserido ou com candidatos novos) reabre todos os seus pares
+        const bool quiet_i = dont_look_ && quiet_swap21_[static_cast<std::size_t>(in_items_[i])];
+        bool open = false; // Algum par (i, j) com candidato de ganho positivo
+
+        const std::vector<std::pair<int, int>> &pairs = pair_lists_[static_cast<std::size_t>(in_items_[i])];
+        PairCursor pair_cursor = pairs.cbegin();
+        const PairCursor pairs_end = pairs.cend();
+
+        for (std::size_t j = i + 1; j < n_in; ++j)
+        {
+            // Linha incompleta: sai sem marcar i
+            if (control.cancelled())
+            {
+                return result;
+            }
+            if (quiet_i && quiet_swap21_[static_cast<std::size_t>(in_items_[j])])
+            {
+                ++result.skipped;
+                continue;
+            }
+
+            const int item_out1 = in_items_[i];
+            const int item_out2 = in_items_[j];
+            const int freed_profit = instance_.profits[item_out1] + instance_.profits[item_out2];
+            const int freed_weight = instance_.weights[item_out1] + instance_.weights[item_out2];
+            const int residual = instance_.capacity - weight_ + freed_weight;
+
+            // Candidatos além dos livres: conflitos só com item_out1 e/ou item_out2
+            pairExtras(i, j, pair_cursor, pairs_end, extras, merged);
+
+            const long long visited_before = result.evaluated;
+            const bool stop = forEachMerged(freeFitting(residual), extras, profit_rank_, result.evaluated, [&](int item_in)
+                                            {
+                const int delta = instance_.profits[item_in] - freed_profit;
+                if (delta <= best_delta)
+                {
+                    open = open || delta > 0;
+                    return sortedByProfit() ? Visit::DONE : Visit::NEXT;
+                }
+                if (instance_.weights[item_in] > residual)
+                {
+                    return Visit::NEXT;
+                }
+                open = true;
+                best_delta = delta;
+                result.outer = i;
+                result.move = Move{.out = {item_out1, item_out2}, .in = {item_in}, .n_out = 2, .n_in = 1,
+                                   .delta_profit = delta,
+                                   .delta_weight = instance_.weights[item_in] - freed_weight};
+                return stopsAtFirst() ? Visit::STOP : Visit::NEXT; });
+            result.pruned += static_cast<long long>(free_count_) + static_cast<long long>(extras.size()) -
+                             (result.evaluated - visited_before);
+            if (stop)
+            {
+                markFirstFound(control, i);
+                return result;
+            }
+        }
+        if (dont_look_ && !open)
+        {
+            result.quiet.push_back(in_items_[i]);
+        }
+    }
+
+    return result;
+}
+
+std::optional<Move> MoveEngine::bestSwap12(const std::atomic<bool> *cancel) noexcept
+{
+    const auto work = static_cast<long long>(in_items_.size() * MULTI_INSERT_CANDIDATES);
+    return runScan([this](std::size_t first, std::size_t stride, ScanControl &control)
+                   { return scanSwap12(first, stride, control); },
+                   work, nullptr, nullptr, cancel);
+}
+
+std::optional<Move> MoveEngine::bestSwap22(const std::atomic<bool> *cancel) noexcept
+{
+    const auto n_in = static_cast<long long>(in_items_.size());
+    return runScan([this](std::size_t first, std::size_t stride, ScanControl &control)
+                   { return scanSwap22(first, stride, control); },
+                   n_in * (n_in - 1), nullptr, nullptr, cancel);
+}
+
+MoveEngine::ScanResult MoveEngine::scanSwap12(std::size_t first, std::size_t stride, ScanControl &control) noexcept
+{
+    ScanResult result;
+    int best_delta = 0;
+    std::vector<int> buffer;
+
+    for (std::size_t i = first; i < in_items_.size(); i += stride)
+    {
+        if ((stopsAtFirst() && i > control.first_found.load(std::memory_order_relaxed)) ||
+            control.cancelled())
+        {
+            break;
+        }
+
+        const int item_out = in_items_[i];
+        const int residual = instance_.capacity - weight_ + instance_.weights[item_out];
+
+        // Os dois itens que entram: livres ou presos só a item_out
+        MergedPrefix candidates(freeFitting(residual), boundTo(i), profit_rank_, MULTI_INSERT_CANDIDATES, buffer);
+        const bool stop = forEachImprovingPair(candidates, instance_, instance_.profits[item_out], residual,
+                                               sortedByProfit(), best_delta, result.evaluated,
+                                               [&](int a, int b, int delta)
+                                               {
+            result.outer = i;
+            result.move = Move{.out = {item_out}, .in = {a, b}, .n_out = 1, .n_in = 2,
+                               .delta_profit = delta,
+                               .delta_weight = instance_.weights[a] + instance_.weights[b] - instance_.weights[item_out]};
+            return stopsAtFirst(); });
+        if (stop)
+        {
+            markFirstFound(control, i);
+            return result;
+        }
+    }
+
+    return result;
+}
+
+MoveEngine::ScanResult MoveEngine::scanSwap22(std::size_t first, std::size_t stride, ScanControl &control) noexcept
+{
+    ScanResult result;
+    int best_delta = 0;
+
+    std::vector<int> extras;
+    std::vector<int> merged;
+    std::vector<int> buffer;
+
+    const std::size_t n_in = in_items_.size();
+    for (std::size_t i = first; i < n_in; i += stride)
+    {
+        if ((stopsAtFirst() && i > control.first_found.load(std::memory_order_relaxed)) ||
+            control.cancelled())
+        {
+            break;
+        }
+
+        const std::vector<std::pair<int, int>> &pairs = pair_lists_[static_cast<std::size_t>(in_items_[i])];
+        PairCursor pair_cursor = pairs.cbegin();
+        const PairCursor pairs_end = pairs.cend();
+
+        for (std::size_t j = i + 1; j < n_in; ++j)
+        {
+            const int item_out1 = in_items_[i];
+            const int item_out2 = in_items_[j];
+            const int freed_profit = instance_.profits[item_out1] + instance_.profits[item_out2];
+            const int freed_weight = instance_.weights[item_out1] + instance_.weights[item_out2];
+            const int residual = instance_.capacity - weight_ + freed_weight;
+
+            pairExtras(i, j, pair_cursor, pairs_end, extras, merged);
+
+            MergedPrefix candidates(freeFitting(residual), extras, profit_rank_, MULTI_INSERT_CANDIDATES, buffer);
+            const bool stop = forEachImprovingPair(candidates, instance_, freed_profit, residual,
+                                                   sortedByProfit(), best_delta, result.evaluated,
+                                                   [&](int a, int b, int delta)
+                                                   {
+                result.outer = i;
+                result.move = Move{.out = {item_out1, item_out2}, .in = {a, b}, .n_out = 2, .n_in = 2,
+                                   .delta_profit = delta,
+                                   .delta_weight = instance_.weights[a] + instance_.weights[b] - freed_weight};
+                return stopsAtFirst(); });
+            if (stop)
+            {
+                markFirstFound(control, i);
+                return result;
+            }
+        }
+    }
+
+    return result;
+}
+
+std::optional<Move> MoveEngine::bestEjectionChain(const std::atomic<bool> *cancel) noexcept
+{
+    // Elo da cadeia: out sai e in (ou nada, in = -1) entra no lugar
+    struct Link
+    {
+        int out;
+        int in;
+        int gain;
+        int delta_weight;
+    };
+
+    long long evaluated = 0;
+
+    // Elos de cada item: remoção pura e os substitutos de maior lucro (livres ou presos a ele)
+    std::vector<Link> links;
+    for (std::size_t p = 0; p < in_items_.size(); ++p)
+    {
+        const int out = in_items_[p];
+        links.push_back({out, -1, -instance_.profits[out], -instance_.weights[out]});
+        int taken = 0;
+        long long visited = 0;
+        forEachMerged(freeFitting(instance_.capacity), boundTo(p), profit_rank_, visited, [&](int in)
+                      {
+            links.push_back({out, in, instance_.profits[in] - instance_.profits[out],
+                             instance_.weights[in] - instance_.weights[out]});
+            return (++taken < CHAIN_LINKS_PER_ITEM) ? Visit::NEXT : Visit::DONE; });
+    }
+
+    // Conjunto limitado: os elos de maior ganho e os que liberam mais peso por lucro perdido
+    std::vector<Link> pool;
+    std::vector<Link> repair;
+    for (const Link &link : links)
+    {
+        if (link.gain > 0)
+        {
+            pool.push_back(link);
+        }
+        else if (link.delta_weight < 0)
+        {
+            repair.push_back(link);
+        }
+    }
+    if (pool.empty())
+    {
+        evaluations_ += evaluated;
+        return std::nullopt;
+    }
+    auto by_gain = [](const Link &a, const Link &b)
+    { return a.gain > b.gain; };
+    std::ranges::stable_sort(pool, by_gain);
+    pool.resize(std::min(pool.size(), CHAIN_POOL));
+    std::ranges::stable_sort(repair, [](const Link &a, const Link &b)
+                             { return static_cast<long long>(a.gain) * -b.delta_weight >
+                                      static_cast<long long>(b.gain) * -a.delta_weight; });
+    pool.insert(pool.end(), repair.begin(), repair.begin() + static_cast<std::ptrdiff_t>(std::min(repair.size(), CHAIN_POOL)));
+    std::ranges::stable_sort(pool, by_gain);
+
+    const int slack = instance_.capacity - weight_;
+    int best_delta = 0;
+    std::optional<Move> best;
+    std::array<std::size_t, Move::MAX_ITEMS> chain{};
+
+    auto compatible = [&](const Link &link, int depth)
+    {
+        for (int d = 0; d < depth; ++d)
+        {
+            const Link &other = pool[chain[static_cast<std::size_t>(d)]];
+            if (other.out == link.out ||
+                (link.in >= 0 && other.in >= 0 &&
+                 (other.in == link.in || instance_.hasConflict(other.in, link.in))))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Elos em ordem crescente de índice no conjunto (combinações, não permutações);
+    // com o conjunto em ordem de ganho, o ganho restante é limitado pelo elo corrente
+    auto extend = [&](auto &self, std::size_t from, int depth, int gain, int delta_weight) -> bool
+    {
+        for (std::size_t t = from; t < pool.size(); ++t)
+        {
+            const Link &link = pool[t];
+            if (gain + (Move::MAX_ITEMS - depth) * std::max(link.gain, 0) <= best_delta)
+            {
+                break;
+            }
+            if (!compatible(link, depth))
+            {
+                continue;
+            }
+            ++evaluated;
+            chain[static_cast<std::size_t>(depth)] = t;
+            const int chain_gain = gain + link.gain;
+            const int chain_weight = delta_weight + link.delta_weight;
+
+            if (depth >= 1 && chain_gain > best_delta && chain_weight <= slack)
+            {
+                best_delta = chain_gain;
+                Move move{.delta_profit = chain_gain, .delta_weight = chain_weight};
+                for (int d = 0; d <= depth; ++d)
+                {
+                    const Link &member = pool[chain[static_cast<std::size_t>(d)]];
+                    move.out[static_cast<std::size_t>(move.n_out++)] = member.out;
+                    if (member.in >= 0)
+                    {
+                        move.in[static_cast<std::size_t>(move.n_in++)] = member.in;
+                    }
+                }
+                best = move;
+                if (stopsAtFirst())
+                {
+                    return true;
+                }
+            }
+            if (depth + 1 < Move::MAX_ITEMS && self(self, t + 1, depth + 1, chain_gain, chain_weight))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (!interrupted(cancel))
+    {
+        extend(extend, 0, 0, 0, 0);
+    }
+
+    evaluations_ += evaluated;
+    if (interrupted(cancel))
+    {
+        return std::nullopt;
+    }
+    return best;
+}
+
+void MoveEngine::apply(Solution &solution, const Move &move)
+{
+    for (int k = 0; k < move.n_out; ++k)
+    {
+        const int item = move.out[static_cast<std::size_t>(k)];
+        solution.removeItem(item, instance_.profits[item], instance_.weights[item]);
+    }
+    for (int k = 0; k < move.n_in; ++k)
+    {
+        const int item = move.in[static_cast<std::size_t>(k)];
+        solution.addItem(item, instance_.profits[item], instance_.weights[item]);
+    }
+    solution.is_feasible = true;
+
+    if (rule_ == PivotRule::SHUFFLED_FIRST_IMPROVEMENT)
+    {
+        // Nova ordem aleatória a cada movimento: reconstrução completa
+        rebuild(solution);
+    }
+    else
+    {
+        // Saídas primeiro: cada item que entra já está livre quando é inserido
+        for (int k = 0; k < move.n_out; ++k)
+        {
+            removeSelected(move.out[static_cast<std::size_t>(k)]);
+        }
+        for (int k = 0; k < move.n_in; ++k)
+        {
+            insertSelected(move.in[static_cast<std::size_t>(k)]);
+        }
+    }
+    if (dont_look_)
+    {
+        wake(move);
+    }
+}
+
+long long MoveEngine::evaluations() const noexcept
+{
+    return evaluations_;
+}
+
+long long MoveEngine::pruned() const noexcept
+{
+    return pruned_;
+}
+
+long long MoveEngine::skipped() const noexcept
+{
+    return skipped_;
+}
+
+void MoveEngine::resetEvaluations() noexcept
+{
+    evaluations_ = 0;
+    pruned_ = 0;
+    skipped_ = 0;
+}
+
+std::string_view MoveEngine::pivotRuleToString(PivotRule rule) noexcept
+{
+    switch (rule)
+    {
+    case PivotRule::BEST_IMPROVEMENT:
+        return "Best";
+    case PivotRule::FIRST_IMPROVEMENT:
+        return "First";
+    case PivotRule::SHUFFLED_FIRST_IMPROVEMENT:
+        return "ShuffledFirst";
+    }
+    return "Unknown";
+}
@@ -0,0 +1,542 @@
+/**
+ * @file move_engine.h
+ * @brief Avaliação de vizinhanças do DCKP por movimentos
+ *
+ * Cada vizinha é avaliada pela variação de lucro e peso e só o melhor
+ * movimento é guardado: memória O(1) por vizinhança, em vez de uma cópia da
+ * solução por vizinha viável.
+ *
+ * load() conta, para cada item fora, os seus conflitos com a solução (e
+ * identifica o parceiro quando há um só). Um item que entra num Swap só pode
+ * conflitar com os itens que saem, então cada vizinhança enumera apenas:
+ *   - itens livres (nenhum conflito);
+ *   - itens cujo único conflito é o item que sai;
+ *   - no Swap(2-1), itens cujos dois conflitos são exatamente o par que sai.
+ * Nenhum teste de conflito é feito na varredura, e o custo acompanha o grau
+ * da solução em vez de n·k. apply() atualiza contagens e listas só nos
+ * vizinhos de conflito dos itens movidos, sem recarregar a solução.
+ *
+ * As listas de candidatos ficam em ordem de lucro decrescente (índice
+ * crescente no empate): a varredura de um item que sai termina no primeiro
+ * candidato que não supera o melhor ganho. Os itens livres ficam numa árvore
+ * de mínimo de peso indexada por essa ordem (MinSegmentTree): a varredura
+ * salta em O(log n) para o próximo livre que cabe na folga, sem visitar os
+ * que não cabem.
+ *
+ * Vizinhanças que inserem dois itens (Swap(1-2), Swap(2-2)) percorrem só um
+ * prefixo de MULTI_INSERT_CANDIDATES candidatos, na ordem de lucro, com poda
+ * pela soma dos lucros e pela folga; a compatibilidade entre os dois itens
+ * é uma busca binária na lista de conflitos. Cadeias de ejeção combinam até
+ * Move::MAX_ITEMS elos (um item sai, um substituto livre ou preso a ele
+ * entra, ou nada entra) tirados de um conjunto limitado de elos de maior
+ * ganho e de maior liberação de peso.
+ *
+ * Com don't-look bits (setDontLookBits), um item que sai cuja varredura não
+ * achou melhoria fica marcado e é pulado nas buscas seguintes. apply()
+ * desmarca só a região afetada pelo movimento: os itens movidos e os
+ * parceiros dos vizinhos de conflito cuja contagem mudou (ganharam ou
+ * perderam candidatos). Mudanças globais (folga maior, item que fica livre)
+ * não desmarcam nada; quem usa os bits confirma o ótimo local com uma
+ * varredura completa após clearDontLookBits().
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef MOVE_ENGINE_H
+#define MOVE_ENGINE_H
+
+#include "../utils/deadline.h"
+#include "../utils/instance_reader.h"
+#include "../utils/min_segment_tree.h"
+#include "../utils/random_engine.h"
+#include "../utils/solution.h"
+#include "../utils/thread_pool.h"
+#include "move.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @enum PivotRule
+ * @brief Regra de escolha do movimento dentro de uma vizinhança
+ */
+enum class PivotRule
+{
+    BEST_IMPROVEMENT,          ///< Varre a vizinhança inteira e fica com o melhor
+    FIRST_IMPROVEMENT,         ///< Para no primeiro movimento que melhora
+    SHUFFLED_FIRST_IMPROVEMENT ///< First improvement com itens em ordem aleatória
+};
+
+/**
+ * @class MoveEngine
+ * @brief Movimento de melhoria de cada vizinhança segundo a PivotRule
+ *
+ * Uso: load() com a solução corrente, uma das funções best*() e, se houver
+ * movimento, apply(). Vizinhos são enumerados em ordem crescente de índice
+ * (embaralhada em SHUFFLED_FIRST_IMPROVEMENT) e, no empate, fica o primeiro
+ * encontrado.
+ *
+ * Com um ThreadPool (setThreadPool), Swap(1-1) e Swap(2-1) dividem o laço
+ * externo entre as threads em faixas intercaladas; cada thread guarda o seu
+ * melhor movimento e a redução fica com o de maior ganho e menor índice
+ * externo no empate. O movimento escolhido é o mesmo da varredura sequencial.
+ *
+ * As funções best*() só leem as listas carregadas: várias vizinhanças podem
+ * ser exploradas ao mesmo tempo sobre a mesma solução (contadores atômicos,
+ * don't-look bits separados por vizinhança). Um flag de cancelamento
+ * interrompe uma varredura cujo resultado deixou de interessar; o resultado
+ * de uma varredura cancelada deve ser descartado. Um Deadline (setDeadline)
+ * interrompe as varreduras da mesma forma quando o tempo acaba, consultado a
+ * cada índice do laço externo.
+ *
+ * @note Com don't-look bits, cada faixa decide a marcação pelo seu próprio
+ *       melhor ganho; os itens marcados (e a trajetória) podem diferir da
+ *       varredura sequencial.
+ */
+class MoveEngine
+{
+public:
+    /**
+     * @brief Construtor
+     * @param inst Referência para a instância do DCKP
+     */
+    explicit MoveEngine(const DCKPInstance &inst) noexcept;
+
+    /**
+     * @brief Carrega a solução corrente (pertinência e listas de itens)
+     * @param solution Solução viável
+     * @note Desmarca todos os don't-look bits
+     */
+    void load(const Solution &solution);
+
+    /**
+     * @brief Define a regra de escolha (default: PivotRule::BEST_IMPROVEMENT)
+     * @param rule Regra de escolha
+     */
+    void setPivotRule(PivotRule rule) noexcept;
+
+    /**
+     * @brief Reinicia o gerador usado para embaralhar a ordem dos itens
+     * @param seed Semente
+     */
+    void setSeed(std::uint64_t seed) noexcept;
+
+    /**
+     * @brief Define o pool usado nas vizinhanças Swap
+     * @param pool Pool de threads (nullptr = sequencial); não é de posse do engine
+     * @note Vizinhanças com menos de PARALLEL_MIN_EVALUATIONS movimentos
+     *       continuam sequenciais
+     */
+    void setThreadPool(ThreadPool *pool) noexcept;
+
+    /**
+     * @brief Ativa os don't-look bits nas vizinhanças Swap (default: desativados)
+     * @param enabled true para pular itens que saem marcados
+     */
+    void setDontLookBits(bool enabled) noexcept;
+
+    /**
+     * @brief Desmarca todos os don't-look bits (próxima varredura é completa)
+     */
+    void clearDontLookBits() noexcept;
+
+    /**
+     * @brief Define o limite de tempo que interrompe as varreduras
+     * @param deadline Limite consultado durante as varreduras (nullptr = nenhum);
+     *                 não é de posse do engine e deve viver enquanto estiver definido
+     * @note Uma varredura interrompida devolve std::nullopt, como uma cancelada
+     */
+    void setDeadline(const Deadline *deadline) noexcept;
+
+    /**
+     * @brief Adia as marcações dos don't-look bits (default: desativado)
+     *
+     * Com o adiamento, os itens que uma varredura marcaria ficam pendentes
+     * até settleSwap11Marks()/settleSwap21Marks(). Serve à exploração
+     * especulativa: as marcas de uma vizinhança que a exploração sequencial
+     * não teria varrido são descartadas.
+     *
+     * @param enabled true para adiar
+     */
+    void setDeferredMarks(bool enabled) noexcept;
+
+    /**
+     * @brief Aplica ou descarta as marcações pendentes do Swap(1-1)
+     * @param keep true para marcar os itens pendentes
+     */
+    void settleSwap11Marks(bool keep) noexcept;
+
+    /**
+     * @brief Aplica ou descarta as marcações pendentes do Swap(2-1)
+     * @param keep true para marcar os itens pendentes
+     */
+    void settleSwap21Marks(bool keep) noexcept;
+
+    /**
+     * @brief Add/Drop: insere um item viável ou remove um item
+     * @param cancel Se apontar para true, a varredura é abandonada (nullptr = nunca)
+     * @return Movimento que melhora escolhido pela PivotRule, ou std::nullopt
+     */
+    [[nodiscard]] std::optional<Move> bestAddDrop(const std::atomic<bool> *cancel = nullptr) noexcept;
+
+    /**
+     * @brief Swap(1-1): troca um item dentro por um fora
+     * @param cancel Se apontar para true, a varredura é abandonada (nullptr = nunca)
+     * @return Movimento que melhora escolhido pela PivotRule, ou std::nullopt
+     */
+    [[nodiscard]] std::optional<Move> bestSwap11(const std::atomic<bool> *cancel = nullptr) noexcept;
+
+    /**
+     * @brief Swap(2-1): remove dois itens e insere um
+     * @param cancel Se apontar para true, a varredura é abandonada (nullptr = nunca)
+     * @return Movimento que melhora escolhido pela PivotRule, ou std::nullopt
+     */
+    [[nodiscard]] std::optional<Move> bestSwap21(const std::atomic<bool> *cancel = nullptr) noexcept;
+
+    /**
+     * @brief Swap(1-2): remove um item e insere dois compatíveis entre si
+     * @param cancel Se apontar para true, a varredura é abandonada (nullptr = nunca)
+     * @return Movimento que melhora escolhido pela PivotRule, ou std::nullopt
+     */
+    [[nodiscard]] std::optional<Move> bestSwap12(const std::atomic<bool> *cancel = nullptr) noexcept;
+
+    /**
+     * @brief Swap(2-2): remove dois itens e insere dois compatíveis entre si
+     * @param cancel Se apontar para true, a varredura é abandonada (nullptr = nunca)
+     * @return Movimento que melhora escolhido pela PivotRule, ou std::nullopt
+     */
+    [[nodiscard]] std::optional<Move> bestSwap22(const std::atomic<bool> *cancel = nullptr) noexcept;
+
+    /**
+     * @brief Cadeia de ejeção: de 2 a Move::MAX_ITEMS elos (sai um item, entra um substituto ou nada)
+     *
+     * Um elo de ganho sozinho inviável pela capacidade é completado por elos
+     * que liberam peso. Sempre sequencial.
+     *
+     * @param cancel Se apontar para true, a varredura é abandonada (nullptr = nunca)
+     * @return Movimento que melhora escolhido pela PivotRule, ou std::nullopt
+     */
+    [[nodiscard]] std::optional<Move> bestEjectionChain(const std::atomic<bool> *cancel = nullptr) noexcept;
+
+    /**
+     * @brief Aplica um movimento sobre a solução carregada e atualiza as listas
+     *
+     * Só os vizinhos de conflito dos itens movidos mudam de lista (livres,
+     * presos, pares): O(grau · log n + k) por item movido, com k itens na
+     * solução. Em SHUFFLED_FIRST_IMPROVEMENT as listas são reconstruídas,
+     * O(n + m), para sortear uma nova ordem.
+     *
+     * @param solution Solução (a mesma de load()), modificada
+     * @param move Movimento viável
+     * @note Os don't-look bits são mantidos, exceto na região afetada pelo movimento
+     */
+    void apply(Solution &solution, const Move &move);
+
+    /**
+     * @brief Movimentos avaliados desde o último resetEvaluations()
+     * @return Número de vizinhos avaliados
+     */
+    [[nodiscard]] long long evaluations() const noexcept;
+
+    /**
+     * @brief Candidatos descartados sem avaliação desde o último resetEvaluations()
+     * @return Número de candidatos podados pela ordem de lucro ou pela folga
+     */
+    [[nodiscard]] long long pruned() const noexcept;
+
+    /**
+     * @brief Itens que saem pulados pelos don't-look bits desde o último resetEvaluations()
+     * @return Número de itens (Swap(1-1)) ou pares (Swap(2-1)) pulados
+     */
+    [[nodiscard]] long long skipped() const noexcept;
+
+    /**
+     * @brief Zera os contadores de movimentos avaliados, podados e pulados
+     */
+    void resetEvaluations() noexcept;
+
+    /**
+     * @brief Converte PivotRule para string
+     * @param rule Regra
+     * @return Nome curto ("Best", "First", "ShuffledFirst")
+     */
+    [[nodiscard]] static std::string_view pivotRuleToString(PivotRule rule) noexcept;
+
+private:
+    const DCKPInstance &instance_; ///< Referência para a instância
+
+    std::vector<char> in_;                                     ///< Pertinência de cada item na solução carregada
+    std::vector<int> in_items_;                                ///< Itens na solução (crescente)
+    std::vector<int> position_;                                ///< Posição de cada item selecionado em in_items_
+    std::vector<int> conflicts_;                               ///< Itens selecionados em conflito com cada item
+    std::vector<std::int64_t> conflict_sum_;                   ///< Soma desses itens (o parceiro, com um conflito)
+    std::vector<std::int64_t> conflict_sq_sum_;                ///< Soma dos quadrados (os dois parceiros, com dois conflitos)
+    std::vector<int> by_profit_;                               ///< Itens em ordem de lucro decrescente
+    std::vector<int> profit_rank_;                             ///< Posição de cada item em by_profit_
+    std::vector<int> scan_order_;                              ///< Ordem de varredura dos livres (lucro; embaralhada em SHUFFLED)
+    std::vector<int> scan_rank_;                               ///< Posição de cada item em scan_order_
+    MinSegmentTree free_tree_;                                 ///< Peso dos itens livres por posição em scan_order_
+    int free_count_ = 0;                                       ///< Itens fora sem conflitos
+    std::vector<std::vector<int>> bound_lists_;                ///< Itens cujo único conflito é cada selecionado (ordem de lucro)
+    std::vector<std::vector<std::pair<int, int>>> pair_lists_; ///< (2º parceiro, item) com dois conflitos, pelo 1º parceiro
+    int bound_count_ = 0;                                      ///< Itens fora com um conflito
+    int pair_count_ = 0;                                       ///< Itens fora com dois conflitos
+    std::vector<char> quiet_swap11_;                           ///< Don't-look bit de cada item no Swap(1-1)
+    std::vector<char> quiet_swap21_;                           ///< Don't-look bit de cada item no Swap(2-1)
+    std::vector<int> deferred_swap11_;                         ///< Marcações adiadas do Swap(1-1)
+    std::vector<int> deferred_swap21_;                         ///< Marcações adiadas do Swap(2-1)
+    int weight_ = 0;                                           ///< Peso da solução carregada
+
+    PivotRule rule_ = PivotRule::BEST_IMPROVEMENT; ///< Regra de escolha
+    prng::Xoshiro256StarStar rng_;                  ///< Embaralhamento da ordem dos itens
+    std::atomic<long long> evaluations_{0};         ///< Movimentos avaliados
+    std::atomic<long long> pruned_{0};              ///< Candidatos podados sem avaliação
+    std::atomic<long long> skipped_{0};             ///< Itens que saem pulados pelos don't-look bits
+    bool dont_look_ = false;                        ///< Don't-look bits ativos
+    bool defer_marks_ = false;                      ///< Marcações ficam pendentes até settle*()
+    ThreadPool *pool_ = nullptr;                    ///< Pool das varreduras paralelas
+    const Deadline *deadline_ = nullptr;            ///< Limite de tempo das varreduras
+
+    /// Tamanho mínimo de vizinhança para dividir a varredura entre threads
+    static constexpr long long PARALLEL_MIN_EVALUATIONS = 1 << 15;
+    /// Candidatos percorridos por item que sai nas vizinhanças que inserem dois itens
+    static constexpr std::size_t MULTI_INSERT_CANDIDATES = 128;
+    /// Substitutos de maior lucro considerados por item na cadeia de ejeção
+    static constexpr int CHAIN_LINKS_PER_ITEM = 2;
+    /// Elos de ganho e elos de reparo (liberação de peso) mantidos na cadeia de ejeção
+    static constexpr std::size_t CHAIN_POOL = 32;
+
+    /**
+     * @class FreeCursor
+     * @brief Percorre os itens livres que cabem numa folga, na ordem de varredura
+     */
+    class FreeCursor
+    {
+    public:
+        FreeCursor(const MoveEngine &engine, int residual) noexcept;
+
+        [[nodiscard]] bool done() const noexcept;
+        [[nodiscard]] int item() const noexcept;
+        void next() noexcept;
+
+    private:
+        const MoveEngine &engine_; ///< Motor dono da árvore de livres
+        int residual_;             ///< Maior peso aceito
+        int position_;             ///< Posição corrente em scan_order_ (-1 = fim)
+    };
+
+    /// Cursor nos pares (2º parceiro, item) de um item selecionado
+    using PairCursor = std::vector<std::pair<int, int>>::const_iterator;
+
+    /**
+     * @brief Estado compartilhado pelas faixas de uma varredura
+     */
+    struct ScanControl
+    {
+        std::atomic<std::size_t> first_found; ///< Menor índice externo com melhoria (first improvement)
+        const std::atomic<bool> *cancel;      ///< Cancelamento externo (nullptr = nenhum)
+        const Deadline *deadline;             ///< Limite de tempo (nullptr = nenhum)
+
+        /**
+         * @brief Indica se a varredura foi cancelada
+         * @return true se o flag externo está ligado ou o tempo acabou
+         */
+        [[nodiscard]] bool cancelled() const noexcept
+        {
+            return (cancel != nullptr && cancel->load(std::memory_order_relaxed)) ||
+                   (deadline != nullptr && deadline->expired());
+        }
+    };
+
+    /**
+     * @brief Resultado da varredura de uma faixa do laço externo
+     */
+    struct ScanResult
+    {
+        std::optional<Move> move; ///< Melhor movimento da faixa
+        std::size_t outer = 0;    ///< Índice externo do movimento
+        long long evaluated = 0;  ///< Movimentos avaliados na faixa
+        long long pruned = 0;     ///< Candidatos podados na faixa
+        long long skipped = 0;    ///< Itens ou pares pulados pelos don't-look bits
+        std::vector<int> quiet;   ///< Itens que saem varridos sem melhoria (a marcar)
+    };
+
+    /**
+     * @brief Indica se a varredura para no primeiro movimento que melhora
+     * @return true nas regras de first improvement
+     */
+    [[nodiscard]] bool stopsAtFirst() const noexcept;
+
+    /**
+     * @brief Indica se uma varredura sem ScanControl deve ser abandonada
+     * @param cancel Flag de cancelamento (nullptr = nenhum)
+     * @return true se o flag está ligado ou o tempo acabou
+     */
+    [[nodiscard]] bool interrupted(const std::atomic<bool> *cancel) const noexcept;
+
+    /**
+     * @brief Embaralha um vetor de itens (Fisher-Yates)
+     * @param items Itens, reordenados no lugar
+     */
+    void shuffle(std::vector<int> &items) noexcept;
+
+    /**
+     * @brief Itens fora cujo único conflito é o item na posição p
+     * @param p Posição em in_items_
+     * @return Itens em ordem crescente
+     */
+    [[nodiscard]] std::span<const int> boundTo(std::size_t p) const noexcept;
+
+    /**
+     * @brief Recalcula pertinência, contagens de conflito e listas de candidatos
+     * @param solution Solução viável
+     */
+    void rebuild(const Solution &solution);
+
+    /**
+     * @brief Desmarca os don't-look bits da região afetada por um movimento aplicado
+     * @param move Movimento (contagens já recalculadas)
+     */
+    void wake(const Move &move) noexcept;
+
+    /**
+     * @brief Constrói as listas de candidatos por parceiro de conflito
+     */
+    void buildCandidateLists();
+
+    /**
+     * @brief Insere um item na solução carregada e reclassifica os seus vizinhos
+     * @param item Item fora da solução e sem conflitos com ela
+     */
+    void insertSelected(int item);
+
+    /**
+     * @brief Remove um item da solução carregada e reclassifica os seus vizinhos
+     * @param item Item da solução
+     */
+    void removeSelected(int item);
+
+    /**
+     * @brief Coloca um item fora na lista da sua contagem de conflitos
+     * @param item Item fora da solução
+     */
+    void attachCandidate(int item);
+
+    /**
+     * @brief Tira um item fora da lista da sua contagem de conflitos
+     * @param item Item fora da solução (contagens ainda não alteradas)
+     */
+    void detachCandidate(int item) noexcept;
+
+    /**
+     * @brief Os dois itens selecionados em conflito com um item de dois conflitos
+     * @param item Item fora com conflicts_[item] == 2
+     * @return (parceiro de menor posição em in_items_, outro parceiro)
+     */
+    [[nodiscard]] std::pair<int, int> pairPartners(std::size_t item) const noexcept;
+
+    /**
+     * @brief Ordena os itens por lucro decrescente (feito uma vez por instância)
+     */
+    void buildProfitOrder();
+
+    /**
+     * @brief Itens livres que cabem na folga, na ordem de varredura
+     * @param residual Capacidade disponível para o item que entra
+     * @return Cursor no primeiro item livre com peso <= residual
+     */
+    [[nodiscard]] FreeCursor freeFitting(int residual) const noexcept;
+
+    /**
+     * @brief Indica se os candidatos estão em ordem de lucro (poda habilitada)
+     * @return false em SHUFFLED_FIRST_IMPROVEMENT
+     */
+    [[nodiscard]] bool sortedByProfit() const noexcept;
+
+    /**
+     * @brief Varre Swap(1-1) para os itens de saída first, first + stride, ...
+     * @param first Primeiro índice de in_items_
+     * @param stride Passo entre índices
+     * @param control Estado compartilhado da varredura
+     * @return Melhor movimento da faixa
+     */
+    [[nodiscard]] ScanResult scanSwap11(std::size_t first, std::size_t stride, ScanControl &control) noexcept;
+
+    /**
+     * @brief Varre Swap(2-1) para os primeiros itens de saída first, first + stride, ...
+     * @param first Primeiro índice de in_items_
+     * @param stride Passo entre índices
+     * @param control Estado compartilhado da varredura
+     * @return Melhor movimento da faixa
+     */
+    [[nodiscard]] ScanResult scanSwap21(std::size_t first, std::size_t stride, ScanControl &control) noexcept;
+
+    /**
+     * @brief Varre Swap(1-2) para os itens de saída first, first + stride, ...
+     * @param first Primeiro índice de in_items_
+     * @param stride Passo entre índices
+     * @param control Estado compartilhado da varredura
+     * @return Melhor movimento da faixa
+     */
+    [[nodiscard]] ScanResult scanSwap12(std::size_t first, std::size_t stride, ScanControl &control) noexcept;
+
+    /**
+     * @brief Varre Swap(2-2) para os primeiros itens de saída first, first + stride, ...
+     * @param first Primeiro índice de in_items_
+     * @param stride Passo entre índices
+     * @param control Estado compartilhado da varredura
+     * @return Melhor movimento da faixa
+     */
+    [[nodiscard]] ScanResult scanSwap22(std::size_t first, std::size_t stride, ScanControl &control) noexcept;
+
+    /**
+     * @brief Candidatos além dos livres para o par de posições (i, j), em ordem de lucro
+     * @param i Posição do primeiro item que sai
+     * @param j Posição do segundo item que sai (crescente entre chamadas com o mesmo cursor)
+     * @param cursor Cursor nos pares do item na posição i, avançado até o parceiro na posição j
+     * @param end Fim dos pares do item na posição i
+     * @param extras Recebe os itens presos a i, a j ou exatamente ao par
+     * @param merged Buffer auxiliar
+     */
+    void pairExtras(std::size_t i, std::size_t j, PairCursor &cursor, PairCursor end,
+                    std::vector<int> &extras, std::vector<int> &merged) const;
+
+    /**
+     * @brief Executa uma varredura em uma faixa ou dividida entre o pool
+     * @param scan Função de varredura (first, stride, control) -> ScanResult
+     * @param work Número de movimentos da vizinhança
+     * @param quiet Don't-look bits da vizinhança, marcados com os itens sem
+     *              melhoria (nullptr = vizinhança sem bits)
+     * @param deferred Pendências da vizinhança, usadas no lugar de quiet
+     *                 com setDeferredMarks(true)
+     * @param cancel Flag de cancelamento (nullptr = nenhum)
+     * @return Movimento escolhido pela PivotRule (std::nullopt se cancelada)
+     */
+    template <typename Scan>
+    [[nodiscard]] std::optional<Move> runScan(Scan scan, long long work, std::vector<char> *quiet,
+                                              std::vector<int> *deferred, const std::atomic<bool> *cancel);
+
+    /**
+     * @brief Marca (keep) ou descarta as pendências de uma vizinhança
+     * @param deferred Pendências, esvaziadas
+     * @param quiet Don't-look bits da vizinhança
+     * @param keep true para marcar
+     */
+    static void settleMarks(std::vector<int> &deferred, std::vector<char> &quiet, bool keep) noexcept;
+
+    /**
+     * @brief Registra que a faixa encontrou melhoria no índice externo outer
+     * @param control Estado compartilhado da varredura
+     * @param outer Índice externo
+     */
+    static void markFirstFound(ScanControl &control, std::size_t outer) noexcept;
+};
+
+#endif // MOVE_ENGINE_H
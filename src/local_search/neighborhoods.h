@@ -0,0 +1,121 @@
+/**
+ * @file neighborhoods.h
+ * @brief Vizinhanças do DCKP como tipos, para sequências em tempo de compilação
+ *
+ * Cada vizinhança é um tipo com um nome e uma função explore() estática sobre
+ * o MoveEngine. O VND é instanciado por lista de tipos, de modo que o laço de
+ * descida chama cada kernel diretamente (inlinável), sem despacho por switch
+ * em tempo de execução.
+ *
+ * Convenção: explore() devolve o movimento que melhora escolhido pela
+ * PivotRule do engine, ou std::nullopt. Vizinhanças com don't-look bits
+ * definem também settle(), que aplica ou descarta as marcações adiadas
+ * (MoveEngine::setDeferredMarks).
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef NEIGHBORHOODS_H
+#define NEIGHBORHOODS_H
+
+#include "move.h"
+#include "move_engine.h"
+
+#include <atomic>
+#include <optional>
+#include <string_view>
+
+namespace neighborhood
+{
+    /**
+     * @brief Add/Drop: insere um item viável ou remove um item
+     */
+    struct AddDrop
+    {
+        static constexpr std::string_view name = "AddDrop";
+
+        [[nodiscard]] static std::optional<Move> explore(MoveEngine &moves, const std::atomic<bool> *cancel) noexcept
+        {
+            return moves.bestAddDrop(cancel);
+        }
+    };
+
+    /**
+     * @brief Swap(1-1): troca um item dentro por um fora
+     */
+    struct Swap11
+    {
+        static constexpr std::string_view name = "Swap11";
+
+        [[nodiscard]] static std::optional<Move> explore(MoveEngine &moves, const std::atomic<bool> *cancel) noexcept
+        {
+            return moves.bestSwap11(cancel);
+        }
+
+        static void settle(MoveEngine &moves, bool keep) noexcept
+        {
+            moves.settleSwap11Marks(keep);
+        }
+    };
+
+    /**
+     * @brief Swap(2-1): remove dois itens e insere um
+     */
+    struct Swap21
+    {
+        static constexpr std::string_view name = "Swap21";
+
+        [[nodiscard]] static std::optional<Move> explore(MoveEngine &moves, const std::atomic<bool> *cancel) noexcept
+        {
+            return moves.bestSwap21(cancel);
+        }
+
+        static void settle(MoveEngine &moves, bool keep) noexcept
+        {
+            moves.settleSwap21Marks(keep);
+        }
+    };
+
+    /**
+     * @brief Swap(1-2): remove um item e insere dois compatíveis entre si
+     */
+    struct Swap12
+    {
+        static constexpr std::string_view name = "Swap12";
+
+        [[nodiscard]] static std::optional<Move> explore(MoveEngine &moves, const std::atomic<bool> *cancel) noexcept
+        {
+            return moves.bestSwap12(cancel);
+        }
+    };
+
+    /**
+     * @brief Swap(2-2): remove dois itens e insere dois compatíveis entre si
+     */
+    struct Swap22
+    {
+        static constexpr std::string_view name = "Swap22";
+
+        [[nodiscard]] static std::optional<Move> explore(MoveEngine &moves, const std::atomic<bool> *cancel) noexcept
+        {
+            return moves.bestSwap22(cancel);
+        }
+    };
+
+    /**
+     * @brief Cadeia de ejeção de até Move::MAX_ITEMS elos
+     */
+    struct EjectionChain
+    {
+        static constexpr std::string_view name = "EjectionChain";
+
+        [[nodiscard]] static std::optional<Move> explore(MoveEngine &moves, const std::atomic<bool> *cancel) noexcept
+        {
+            return moves.bestEjectionChain(cancel);
+        }
+    };
+
+} // namespace neighborhood
+
+#endif // NEIGHBORHOODS_H
@@ -0,0 +1,482 @@
+/**
+ * @file tabu_search.cpp
+ * @brief Implementação da Busca Tabu para o DCKP
+ */
+
+#include "tabu_search.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+void TabuSearch::ItemSet::reset(int n)
+{
+    items.clear();
+    position.assign(static_cast<std::size_t>(n), -1);
+}
+
+void TabuSearch::ItemSet::insert(int item) noexcept
+{
+    position[static_cast<std::size_t>(item)] = static_cast<int>(items.size());
+    items.push_back(item);
+}
+
+void TabuSearch::ItemSet::erase(int item) noexcept
+{
+    // Troca com o último: O(1), a ordem dos itens não importa
+    const auto at = static_cast<std::size_t>(position[static_cast<std::size_t>(item)]);
+    const int last = items.back();
+    items[at] = last;
+    position[static_cast<std::size_t>(last)] = static_cast<int>(at);
+    items.pop_back();
+    position[static_cast<std::size_t>(item)] = -1;
+}
+
+TabuSearch::TabuSearch(const DCKPInstance &inst)
+    : instance_(inst)
+{
+    const auto n = static_cast<std::size_t>(inst.n_items);
+    in_.reserve(n);
+    conflicts_.reserve(n);
+    conflict_sum_.reserve(n);
+    add_tabu_until_.reserve(n);
+    drop_tabu_until_.reserve(n);
+}
+
+Solution TabuSearch::solve(const Solution &initial_solution, int max_iterations,
+                           const Deadline &deadline)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    Solution current_sol = initial_solution;
+    current_sol.method_name = "TabuSearch";
+    improve(current_sol, max_iterations, deadline);
+
+    const auto end = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = end - start;
+    current_sol.computation_time = elapsed.count();
+
+    const double rate = (current_sol.computation_time > 0.0)
+                            ? static_cast<double>(stats_.evaluations) / current_sol.computation_time
+                            : 0.0;
+
+    std::cout << "TabuSearch: "
+              << "Valor = " << current_sol.total_profit
+              << ", Iteracoes = " << stats_.iterations
+              << ", Melhorias = " << stats_.improvements
+              << ", Aspiracoes = " << aspirations_
+              << ", Avaliacoes = " << stats_.evaluations
+              << " (" << std::scientific << std::setprecision(2) << rate << "/s)"
+              << ", Tempo = " << std::fixed << std::setprecision(4)
+              << current_sol.computation_time << "s";
+    if (stats_.time_limit_reached)
+    {
+        std::cout << " [limite de tempo]";
+    }
+    std::cout << '\n';
+
+    if (log_trace_)
+    {
+        for (const TabuTraceEntry &entry : trace_)
+        {
+            std::cout << "  Iteracao " << entry.iteration
+                      << " (" << std::fixed << std::setprecision(4) << entry.time << "s)"
+                      << ": Valor = " << entry.profit << '\n';
+        }
+    }
+
+    return current_sol;
+}
+
+void TabuSearch::improve(Solution &current_sol, int max_iterations, const Deadline &deadline)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    stats_ = LocalSearchStats{};
+    aspirations_ = 0;
+    trace_.clear();
+    load(current_sol);
+
+    int best_profit = profit_;
+    std::vector<int> best_items = selected_.items;
+    trace_.push_back({0, 0.0, profit_});
+
+    int iteration = 0;
+    while (iteration < max_iterations)
+    {
+        if (deadline.expired())
+        {
+            stats_.time_limit_reached = true;
+            break;
+        }
+
+        bool aspirated = false;
+        const std::optional<Move> move = findMove(iteration, best_profit, aspirated);
+        if (!move)
+        {
+            // Todos os movimentos estão proibidos
+            break;
+        }
+
+        apply(*move, iteration);
+        ++iteration;
+        if (aspirated)
+        {
+            ++aspirations_;
+        }
+
+        if (profit_ > best_profit)
+        {
+            best_profit = profit_;
+            best_items = selected_.items;
+            ++stats_.improvements;
+
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            trace_.push_back({iteration, elapsed.count(), profit_});
+        }
+    }
+
+    stats_.iterations = iteration;
+
+    current_sol.clear();
+    for (int item : best_items)
+    {
+        const auto i = static_cast<std::size_t>(item);
+        current_sol.addItem(item, instance_.profits[i], instance_.weights[i]);
+    }
+}
+
+void TabuSearch::load(const Solution &solution)
+{
+    const int n = instance_.n_items;
+    const auto size = static_cast<std::size_t>(n);
+
+    in_.assign(size, 0);
+    conflicts_.assign(size, 0);
+    conflict_sum_.assign(size, 0);
+    add_tabu_until_.assign(size, 0);
+    drop_tabu_until_.assign(size, 0);
+    selected_.reset(n);
+    free_.reset(n);
+    bound_.reset(n);
+    profit_ = solution.total_profit;
+    weight_ = solution.total_weight;
+
+    by_weight_.clear();
+    for (int item : solution.selected_items)
+    {
+        in_[static_cast<std::size_t>(item)] = 1;
+        selected_.insert(item);
+        by_weight_.push_back(item);
+        for (int neighbor : instance_.conflict_graph[static_cast<std::size_t>(item)])
+        {
+            ++conflicts_[static_cast<std::size_t>(neighbor)];
+            conflict_sum_[static_cast<std::size_t>(neighbor)] += item;
+        }
+    }
+
+    for (int item = 0; item < n; ++item)
+    {
+        const auto i = static_cast<std::size_t>(item);
+        if (in_[i])
+        {
+            continue;
+        }
+        if (conflicts_[i] == 0)
+        {
+            free_.insert(item);
+        }
+        else if (conflicts_[i] == 1)
+        {
+            bound_.insert(item);
+        }
+    }
+
+    // Tabelas de prefixo recalculadas por inteiro na primeira iteração
+    std::ranges::sort(by_weight_, [this](int a, int b)
+                      {
+        const int wa = instance_.weights[static_cast<std::size_t>(a)];
+        const int wb = instance_.weights[static_cast<std::size_t>(b)];
+        return wa > wb || (wa == wb && a < b); });
+    stale_from_ = 0;
+    drop_expiry_.assign(static_cast<std::size_t>(tenure_base_ + tenure_spread_) + 1, {});
+}
+
+std::vector<int>::iterator TabuSearch::weightSlot(int item) noexcept
+{
+    const int w = instance_.weights[static_cast<std::size_t>(item)];
+    return std::ranges::lower_bound(by_weight_, item, [this, w, item](int other, int)
+                                    {
+        const int wo = instance_.weights[static_cast<std::size_t>(other)];
+        return wo > w || (wo == w && other < item); });
+}
+
+void TabuSearch::refreshLightest(int iteration) noexcept
+{
+    const std::size_t k_end = by_weight_.size();
+    lightest_.resize(k_end);
+    lightest_ok_.resize(k_end);
+
+    // Prefixos antes de stale_from_ continuam válidos: recomeça do anterior
+    const auto &profits = instance_.profits;
+    int cheapest = (stale_from_ > 0) ? lightest_[stale_from_ - 1] : -1;
+    int cheapest_ok = (stale_from_ > 0) ? lightest_ok_[stale_from_ - 1] : -1;
+    for (std::size_t k = stale_from_; k < k_end; ++k)
+    {
+        const int item = by_weight_[k];
+        const int p = profits[static_cast<std::size_t>(item)];
+        if (cheapest < 0 || p < profits[static_cast<std::size_t>(cheapest)])
+        {
+            cheapest = item;
+        }
+        if (iteration >= drop_tabu_until_[static_cast<std::size_t>(item)] &&
+            (cheapest_ok < 0 || p < profits[static_cast<std::size_t>(cheapest_ok)]))
+        {
+            cheapest_ok = item;
+        }
+        lightest_[k] = cheapest;
+        lightest_ok_[k] = cheapest_ok;
+    }
+    stale_from_ = k_end;
+}
+
+void TabuSearch::reclassify(int item, int before) noexcept
+{
+    const int after = conflicts_[static_cast<std::size_t>(item)];
+    if (before == 0)
+    {
+        free_.erase(item);
+    }
+    else if (before == 1)
+    {
+        bound_.erase(item);
+    }
+
+    if (after == 0)
+    {
+        free_.insert(item);
+    }
+    else if (after == 1)
+    {
+        bound_.insert(item);
+    }
+}
+
+void TabuSearch::insert(int item) noexcept
+{
+    const auto i = static_cast<std::size_t>(item);
+    free_.erase(item);
+    selected_.insert(item);
+    in_[i] = 1;
+    profit_ += instance_.profits[i];
+    weight_ += instance_.weights[i];
+
+    const auto slot = weightSlot(item);
+    stale_from_ = std::min(stale_from_, static_cast<std::size_t>(slot - by_weight_.begin()));
+    by_weight_.insert(slot, item);
+
+    for (int neighbor : instance_.conflict_graph[i])
+    {
+        const auto u = static_cast<std::size_t>(neighbor);
+        const int before = conflicts_[u]++;
+        conflict_sum_[u] += item;
+        if (!in_[u] && before <= 1)
+        {
+            reclassify(neighbor, before);
+        }
+    }
+}
+
+void TabuSearch::remove(int item) noexcept
+{
+    const auto i = static_cast<std::size_t>(item);
+    selected_.erase(item);
+    in_[i] = 0;
+    profit_ -= instance_.profits[i];
+    weight_ -= instance_.weights[i];
+
+    const auto slot = weightSlot(item);
+    stale_from_ = std::min(stale_from_, static_cast<std::size_t>(slot - by_weight_.begin()));
+    by_weight_.erase(slot);
+
+    for (int neighbor : instance_.conflict_graph[i])
+    {
+        const auto u = static_cast<std::size_t>(neighbor);
+        const int before = conflicts_[u]--;
+        conflict_sum_[u] -= item;
+        if (!in_[u] && before <= 2)
+        {
+            reclassify(neighbor, before);
+        }
+    }
+
+    // A solução é viável, então o item removido não tem conflitos com ela
+    free_.insert(item);
+}
+
+std::optional<Move> TabuSearch::findMove(int iteration, int best_profit, bool &aspirated)
+{
+    const auto &profits = instance_.profits;
+    const auto &weights = instance_.weights;
+    const int residual = instance_.capacity - weight_;
+    const int aspiration = best_profit - profit_; // Ganho que supera a melhor solução
+
+    std::optional<Move> best;
+    long long evaluated = 0;
+
+    auto addTabu = [&](int item)
+    { return iteration < add_tabu_until_[static_cast<std::size_t>(item)]; };
+    auto dropTabu = [&](int item)
+    { return iteration < drop_tabu_until_[static_cast<std::size_t>(item)]; };
+    auto consider = [&](int out, int in, bool tabu)
+    {
+        ++evaluated;
+        const int delta = (in >= 0 ? profits[static_cast<std::size_t>(in)] : 0) -
+                          (out >= 0 ? profits[static_cast<std::size_t>(out)] : 0);
+        if ((tabu && delta <= aspiration) || (best && delta <= best->delta_profit))
+        {
+            return;
+        }
+        Move move;
+        if (out >= 0)
+        {
+            move.out[0] = out;
+            move.n_out = 1;
+            move.delta_weight -= weights[static_cast<std::size_t>(out)];
+        }
+        if (in >= 0)
+        {
+            move.in[0] = in;
+            move.n_in = 1;
+            move.delta_weight += weights[static_cast<std::size_t>(in)];
+        }
+        move.delta_profit = delta;
+        best = move;
+        aspirated = tabu;
+    };
+
+    // Selecionados em peso decrescente, com o de menor lucro de cada prefixo:
+    // um item livre que não cabe troca com o mais barato entre os pesados o
+    // bastante. by_weight_ é mantido por insert()/remove(); as tabelas só
+    // mudam a partir da primeira posição alterada ou de um item cuja
+    // proibição de saída termina agora
+    std::vector<int> &expiring = drop_expiry_[static_cast<std::size_t>(iteration) % drop_expiry_.size()];
+    for (int item : expiring)
+    {
+        if (in_[static_cast<std::size_t>(item)] && drop_tabu_until_[static_cast<std::size_t>(item)] == iteration)
+        {
+            stale_from_ = std::min(stale_from_, static_cast<std::size_t>(weightSlot(item) - by_weight_.begin()));
+        }
+    }
+    expiring.clear();
+    refreshLightest(iteration);
+
+    // Add e Swap com itens livres
+    for (int in : free_.items)
+    {
+        const int w = weights[static_cast<std::size_t>(in)];
+        const bool in_tabu = addTabu(in);
+        if (w <= residual)
+        {
+            consider(-1, in, in_tabu);
+            continue;
+        }
+
+        const int need = w - residual;
+        const auto heavy = std::ranges::partition_point(
+            by_weight_, [&](int item)
+            { return weights[static_cast<std::size_t>(item)] >= need; });
+        const auto count = static_cast<std::size_t>(heavy - by_weight_.begin());
+        if (count == 0)
+        {
+            continue;
+        }
+        const int out = lightest_[count - 1];
+        const bool out_tabu = dropTabu(out);
+        consider(out, in, in_tabu || out_tabu);
+        if (out_tabu && !in_tabu && lightest_ok_[count - 1] >= 0)
+        {
+            consider(lightest_ok_[count - 1], in, false);
+        }
+    }
+
+    // Swap com itens presos a um único selecionado: o parceiro tem de sair
+    for (int in : bound_.items)
+    {
+        const auto j = static_cast<std::size_t>(in);
+        const auto out = static_cast<int>(conflict_sum_[j]);
+        if (weights[j] - weights[static_cast<std::size_t>(out)] <= residual)
+        {
+            consider(out, in, addTabu(in) || dropTabu(out));
+        }
+    }
+
+    // Drop: nunca aspira, então só o mais barato que pode sair
+    if (!by_weight_.empty() && lightest_ok_.back() >= 0)
+    {
+        consider(lightest_ok_.back(), -1, false);
+    }
+
+    stats_.evaluations += evaluated;
+    return best;
+}
+
+void TabuSearch::apply(const Move &move, int iteration) noexcept
+{
+    // Remove antes de inserir: o item preso fica livre quando o parceiro sai
+    for (int k = 0; k < move.n_out; ++k)
+    {
+        const int item = move.out[static_cast<std::size_t>(k)];
+        remove(item);
+        add_tabu_until_[static_cast<std::size_t>(item)] = iteration + tenure();
+    }
+    for (int k = 0; k < move.n_in; ++k)
+    {
+        const int item = move.in[static_cast<std::size_t>(k)];
+        insert(item);
+        const int until = iteration + tenure();
+        drop_tabu_until_[static_cast<std::size_t>(item)] = until;
+        drop_expiry_[static_cast<std::size_t>(until) % drop_expiry_.size()].push_back(item);
+    }
+}
+
+int TabuSearch::tenure() noexcept
+{
+    if (tenure_spread_ <= 0)
+    {
+        return tenure_base_;
+    }
+    return tenure_base_ + static_cast<int>(prng::bounded(rng_, static_cast<std::uint32_t>(tenure_spread_) + 1));
+}
+
+const LocalSearchStats &TabuSearch::lastStats() const noexcept
+{
+    return stats_;
+}
+
+const std::vector<TabuTraceEntry> &TabuSearch::trace() const noexcept
+{
+    return trace_;
+}
+
+long long TabuSearch::aspirations() const noexcept
+{
+    return aspirations_;
+}
+
+void TabuSearch::setTenure(int base, int spread) noexcept
+{
+    tenure_base_ = std::max(base, 0);
+    tenure_spread_ = std::max(spread, 0);
+}
+
+void TabuSearch::setSeed(std::uint64_t seed) noexcept
+{
+    rng_.seed(seed);
+}
+
+void TabuSearch::setTraceLog(bool enabled) noexcept
+{
+    log_trace_ = enabled;
+}
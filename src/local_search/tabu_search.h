@@ -0,0 +1,227 @@
+/**
+ * @file tabu_search.h
+ * @brief Busca Tabu sobre movimentos Add, Drop e Swap(1-1) para o DCKP
+ *
+ * Diferente de HillClimbing e VND, a Busca Tabu aceita o melhor movimento
+ * admissível mesmo quando ele piora a solução, o que permite sair do primeiro
+ * ótimo local. Movimentos que desfazem decisões recentes ficam proibidos por
+ * um prazo (tenure) por item; o critério de aspiração libera um movimento
+ * tabu que leva a uma solução melhor que a melhor já encontrada.
+ *
+ * O estado (contagem de conflitos com a solução, itens livres e itens presos
+ * a um único selecionado) é atualizado em O(grau) por item inserido ou
+ * removido, sem reconstrução a cada movimento. Os selecionados em ordem de
+ * peso também são mantidos por inserção ordenada, e as tabelas do item mais
+ * barato por prefixo só são refeitas a partir da primeira posição alterada.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef TABU_SEARCH_H
+#define TABU_SEARCH_H
+
+#include "../utils/deadline.h"
+#include "../utils/instance_reader.h"
+#include "../utils/random_engine.h"
+#include "../utils/solution.h"
+#include "local_search_stats.h"
+#include "move.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @struct TabuTraceEntry
+ * @brief Ponto da trajetória de melhorias da Busca Tabu
+ */
+struct TabuTraceEntry
+{
+    int iteration = 0; ///< Iteração em que a melhor solução foi atingida
+    double time = 0.0; ///< Segundos desde o início da busca
+    int profit = 0;    ///< Lucro da nova melhor solução
+};
+
+/**
+ * @class TabuSearch
+ * @brief Busca Tabu com memória de curto prazo por item
+ *
+ * Vizinhança: inserir um item viável (Add), remover um item (Drop) ou trocar
+ * um item dentro por um fora (Swap). Um item removido não pode voltar e um
+ * item inserido não pode sair durante a sua tenure, sorteada em
+ * [base, base + spread] a cada movimento.
+ */
+class TabuSearch
+{
+public:
+    /**
+     * @brief Construtor
+     * @param inst Referência para a instância do DCKP
+     */
+    explicit TabuSearch(const DCKPInstance &inst);
+
+    /**
+     * @brief Executa a Busca Tabu a partir de uma solução inicial
+     *
+     * @param initial_solution Solução inicial viável (tipicamente de um construtivo)
+     * @param max_iterations Número máximo de movimentos
+     * @param deadline Orçamento de tempo; consultado uma vez por iteração
+     * @return Melhor solução visitada
+     */
+    [[nodiscard]] Solution solve(const Solution &initial_solution, int max_iterations = 10000,
+                                 const Deadline &deadline = Deadline());
+
+    /**
+     * @brief Aplica a busca sobre uma solução, sem imprimir resumo
+     *
+     * @param current_sol Solução substituída pela melhor visitada
+     * @param max_iterations Número máximo de movimentos
+     * @param deadline Orçamento de tempo; consultado uma vez por iteração
+     */
+    void improve(Solution &current_sol, int max_iterations = 10000,
+                 const Deadline &deadline = Deadline());
+
+    /**
+     * @brief Estatísticas da última execução
+     * @return Iterações, melhorias da melhor solução e indicação de parada por tempo
+     * @note Válido após solve() ou improve()
+     */
+    [[nodiscard]] const LocalSearchStats &lastStats() const noexcept;
+
+    /**
+     * @brief Trajetória de melhorias da última execução
+     * @return Um ponto para a solução inicial e um para cada nova melhor solução
+     */
+    [[nodiscard]] const std::vector<TabuTraceEntry> &trace() const noexcept;
+
+    /**
+     * @brief Movimentos tabu aceitos pelo critério de aspiração na última execução
+     * @return Número de aspirações
+     */
+    [[nodiscard]] long long aspirations() const noexcept;
+
+    /**
+     * @brief Define a tenure tabu (default: base 7, spread 8)
+     * @param base Menor número de iterações que um item fica proibido
+     * @param spread Acréscimo máximo sorteado sobre a base
+     */
+    void setTenure(int base, int spread) noexcept;
+
+    /**
+     * @brief Reinicia o gerador que sorteia as tenures
+     * @param seed Semente
+     */
+    void setSeed(std::uint64_t seed) noexcept;
+
+    /**
+     * @brief Imprime a trajetória de melhorias após o resumo de solve()
+     * @param enabled true para imprimir (default: false)
+     */
+    void setTraceLog(bool enabled) noexcept;
+
+private:
+    /**
+     * @struct ItemSet
+     * @brief Conjunto de itens com inserção e remoção O(1) e iteração densa
+     */
+    struct ItemSet
+    {
+        std::vector<int> items;    ///< Itens do conjunto (ordem arbitrária)
+        std::vector<int> position; ///< Posição de cada item em items (-1 = ausente)
+
+        void reset(int n);
+        void insert(int item) noexcept;
+        void erase(int item) noexcept;
+    };
+
+    const DCKPInstance &instance_;       ///< Referência para a instância
+    LocalSearchStats stats_;             ///< Estatísticas da última execução
+    std::vector<TabuTraceEntry> trace_;  ///< Trajetória de melhorias da última execução
+    long long aspirations_ = 0;          ///< Aspirações da última execução
+    prng::Xoshiro256StarStar rng_;       ///< Sorteio das tenures
+    int tenure_base_ = 7;                ///< Tenure mínima
+    int tenure_spread_ = 8;              ///< Acréscimo máximo sorteado
+    bool log_trace_ = false;             ///< Imprime a trajetória em solve()
+
+    std::vector<char> in_;                   ///< Pertinência de cada item na solução corrente
+    std::vector<int> conflicts_;             ///< Itens selecionados em conflito com cada item
+    std::vector<std::int64_t> conflict_sum_; ///< Soma desses itens (o parceiro, com um conflito)
+    ItemSet selected_;                       ///< Itens na solução corrente
+    ItemSet free_;                           ///< Itens fora sem conflitos com a solução
+    ItemSet bound_;                          ///< Itens fora com exatamente um conflito
+    std::vector<int> add_tabu_until_;        ///< Iteração até a qual o item não pode entrar
+    std::vector<int> drop_tabu_until_;       ///< Iteração até a qual o item não pode sair
+    int profit_ = 0;                         ///< Lucro da solução corrente
+    int weight_ = 0;                         ///< Peso da solução corrente
+
+    std::vector<int> by_weight_;                ///< Selecionados em peso decrescente (índice crescente no empate)
+    std::vector<int> lightest_;                 ///< Menor lucro entre by_weight_[0..k] (item)
+    std::vector<int> lightest_ok_;              ///< Idem, só itens que podem sair (-1 = nenhum)
+    std::size_t stale_from_ = 0;                ///< Primeira posição de lightest_/lightest_ok_ a recalcular
+    std::vector<std::vector<int>> drop_expiry_; ///< Itens cuja proibição de saída termina em cada iteração (anel)
+
+    /**
+     * @brief Carrega a solução e reinicia a memória tabu em O(n + m)
+     * @param solution Solução viável
+     */
+    void load(const Solution &solution);
+
+    /**
+     * @brief Insere um item e atualiza conflitos e conjuntos dos vizinhos
+     * @param item Item fora da solução e sem conflitos com ela
+     */
+    void insert(int item) noexcept;
+
+    /**
+     * @brief Remove um item e atualiza conflitos e conjuntos dos vizinhos
+     * @param item Item da solução
+     */
+    void remove(int item) noexcept;
+
+    /**
+     * @brief Posição de um item selecionado (ou a sua posição de inserção) em by_weight_
+     * @param item Item
+     * @return Iterador em by_weight_ (peso decrescente, índice crescente no empate)
+     */
+    [[nodiscard]] std::vector<int>::iterator weightSlot(int item) noexcept;
+
+    /**
+     * @brief Recalcula lightest_ e lightest_ok_ a partir de stale_from_
+     * @param iteration Iteração corrente (define quem pode sair)
+     */
+    void refreshLightest(int iteration) noexcept;
+
+    /**
+     * @brief Move um item fora para o conjunto da sua nova contagem de conflitos
+     * @param item Item fora da solução
+     * @param before Contagem de conflitos antes da atualização
+     */
+    void reclassify(int item, int before) noexcept;
+
+    /**
+     * @brief Escolhe o melhor movimento admissível (não tabu ou aspirado)
+     *
+     * @param iteration Iteração corrente
+     * @param best_profit Lucro da melhor solução visitada (aspiração)
+     * @param aspirated Recebe true se o movimento escolhido é tabu
+     * @return Melhor movimento, ou std::nullopt se todos são tabu
+     */
+    [[nodiscard]] std::optional<Move> findMove(int iteration, int best_profit, bool &aspirated);
+
+    /**
+     * @brief Aplica o movimento e torna tabu o retorno dos itens movidos
+     * @param move Movimento escolhido por findMove()
+     * @param iteration Iteração corrente
+     */
+    void apply(const Move &move, int iteration) noexcept;
+
+    /**
+     * @brief Sorteia a tenure de um movimento
+     * @return Número de iterações em [base, base + spread]
+     */
+    [[nodiscard]] int tenure() noexcept;
+};
+
+#endif // TABU_SEARCH_H
@@ -4,297 +4,302 @@
  */
 
 #include "vnd.h"
+#include "neighborhoods.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <future>
 #include <iomanip>
 #include <iostream>
-#include <vector>
 
 VND::VND(const DCKPInstance &inst) noexcept
-    : instance_(inst), validator_(inst) {}
+    : pivot_rule_(PivotRule::BEST_IMPROVEMENT),
+      order_(NeighborhoodOrder::ADD_DROP_SWAP11_SWAP21), moves_(inst) {}
 
-std::vector<Solution> VND::generateAddDropNeighborhood(const Solution &current_sol) const
+template <typename... Neighborhoods>
+std::optional<Move> VND::exploreAt(int k, const std::atomic<bool> *cancel)
 {
-    std::vector<Solution> neighborhood;
-    neighborhood.reserve(static_cast<std::size_t>(instance_.n_items));
-
-    // Movimentos ADD: tenta adicionar cada item não presente na solução
-    for (int i = 0; i < instance_.n_items; ++i)
-    {
-        if (current_sol.hasItem(i))
-        {
-            continue;
-        }
+    // Expande em uma cadeia de comparações com chamadas diretas a cada kernel
+    std::optional<Move> move;
+    int index = 0;
+    (void)((++index == k && (move = Neighborhoods::explore(moves_, cancel), true)) || ...);
+    return move;
+}
 
-        // Verifica capacidade
-        if (current_sol.total_weight + instance_.weights[i] > instance_.capacity)
+template <typename... Neighborhoods>
+void VND::settleMarks(int found) noexcept
+{
+    int index = 0;
+    ([&]
+     {
+        ++index;
+        if constexpr (requires(MoveEngine &moves) { Neighborhoods::settle(moves, true); })
         {
-            continue;
-        }
+            Neighborhoods::settle(moves_, index <= found);
+        } }(),
+     ...);
+}
 
-        // Verifica conflitos
-        bool has_conflict = false;
-        for (int selected : current_sol.selected_items)
-        {
-            if (instance_.hasConflict(i, selected))
-            {
-                has_conflict = true;
-                break;
-            }
-        }
+template <typename... Neighborhoods>
+std::pair<int, std::optional<Move>> VND::exploreSpeculative(int first, int last)
+{
+    constexpr std::size_t SLOTS = sizeof...(Neighborhoods) + 1;
+    std::array<std::atomic<bool>, SLOTS> cancel{};
+    std::array<std::future<std::optional<Move>>, SLOTS> pending;
+    auto explore = [this, &cancel](int k)
+    {
+        return exploreAt<Neighborhoods...>(k, &cancel[static_cast<std::size_t>(k)]);
+    };
+    for (int k = first + 1; k <= last; ++k)
+    {
+        pending[static_cast<std::size_t>(k)] = speculative_pool_->submit([&explore, k]
+                                                                          { return explore(k); });
+    }
 
-        if (has_conflict)
+    auto cancelAbove = [&](int found)
+    {
+        for (int k = found + 1; k <= last; ++k)
         {
-            continue;
+            cancel[static_cast<std::size_t>(k)].store(true, std::memory_order_relaxed);
         }
+    };
 
-        Solution neighbor = current_sol;
-        neighbor.addItem(i, instance_.profits[i], instance_.weights[i]);
-        neighbor.is_feasible = true;
-        neighborhood.push_back(std::move(neighbor));
-    }
-
-    // Movimentos DROP: tenta remover cada item da solução
-    for (int item : current_sol.selected_items)
+    std::optional<Move> best = exploreAt<Neighborhoods...>(first);
+    int found = last + 1;
+    if (best)
     {
-        Solution neighbor = current_sol;
-        neighbor.removeItem(item, instance_.profits[item], instance_.weights[item]);
-        neighbor.is_feasible = true;
-        neighborhood.push_back(std::move(neighbor));
+        found = first;
+        cancelAbove(first);
     }
 
-    return neighborhood;
-}
-
-std::vector<Solution> VND::generateSwap11Neighborhood(const Solution &current_sol) const
-{
-    std::vector<Solution> neighborhood;
-
-    std::vector<int> in_solution(current_sol.selected_items.begin(),
-                                 current_sol.selected_items.end());
-
-    std::vector<int> out_solution;
-    out_solution.reserve(static_cast<std::size_t>(instance_.n_items) - in_solution.size());
-    for (int i = 0; i < instance_.n_items; ++i)
+    // Todas as tarefas terminam antes de a solução carregada mudar; as
+    // canceladas devolvem std::nullopt e nunca estão abaixo de found
+    for (int k = first + 1; k <= last; ++k)
     {
-        if (!current_sol.hasItem(i))
+        std::optional<Move> move = pending[static_cast<std::size_t>(k)].get();
+        if (found > last && move)
         {
-            out_solution.push_back(i);
+            found = k;
+            best = move;
+            cancelAbove(k);
         }
     }
+    return {found, best};
+}
 
-    neighborhood.reserve(in_solution.size() * out_solution.size() / 4);
+Solution VND::solve(const Solution &initial_solution, int max_iterations,
+                    const Deadline &deadline)
+{
+    const auto start = std::chrono::steady_clock::now();
 
-    for (int item_out : in_solution)
+    Solution current_sol = initial_solution;
+    current_sol.method_name = "VND";
+    if (pivot_rule_ != PivotRule::BEST_IMPROVEMENT)
     {
-        const int weight_freed = instance_.weights[item_out];
-        const int profit_lost = instance_.profits[item_out];
-
-        for (int item_in : out_solution)
-        {
-            const int new_weight = current_sol.total_weight - weight_freed + instance_.weights[item_in];
-
-            if (new_weight > instance_.capacity)
-            {
-                continue;
-            }
-
-            bool has_conflict = false;
-            for (int remaining : current_sol.selected_items)
-            {
-                if (remaining == item_out)
-                {
-                    continue;
-                }
-                if (instance_.hasConflict(item_in, remaining))
-                {
-                    has_conflict = true;
-                    break;
-                }
-            }
-
-            if (has_conflict)
-            {
-                continue;
-            }
-
-            Solution neighbor = current_sol;
-            neighbor.removeItem(item_out, profit_lost, weight_freed);
-            neighbor.addItem(item_in, instance_.profits[item_in], instance_.weights[item_in]);
-            neighbor.is_feasible = true;
-            neighborhood.push_back(std::move(neighbor));
-        }
+        current_sol.method_name += '_';
+        current_sol.method_name += MoveEngine::pivotRuleToString(pivot_rule_);
     }
+    improve(current_sol, max_iterations, deadline);
 
-    return neighborhood;
-}
-
-std::vector<Solution> VND::generateSwap21Neighborhood(const Solution &current_sol) const
-{
-    std::vector<Solution> neighborhood;
+    const auto end = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = end - start;
+    current_sol.computation_time = elapsed.count();
 
-    std::vector<int> in_solution(current_sol.selected_items.begin(),
-                                 current_sol.selected_items.end());
+    const double rate = (current_sol.computation_time > 0.0)
+                            ? static_cast<double>(stats_.evaluations) / current_sol.computation_time
+                            : 0.0;
 
-    if (in_solution.size() < 2)
+    std::cout << "VND";
+    if (pivot_rule_ != PivotRule::BEST_IMPROVEMENT)
     {
-        return neighborhood;
+        std::cout << " (" << MoveEngine::pivotRuleToString(pivot_rule_) << ')';
     }
-
-    std::vector<int> out_solution;
-    out_solution.reserve(static_cast<std::size_t>(instance_.n_items) - in_solution.size());
-    for (int i = 0; i < instance_.n_items; ++i)
+    if (order_ != NeighborhoodOrder::ADD_DROP_SWAP11_SWAP21)
     {
-        if (!current_sol.hasItem(i))
-        {
-            out_solution.push_back(i);
-        }
+        std::cout << " [" << neighborhoodOrderToString(order_) << ']';
     }
-
-    // Gera todos os movimentos Swap(2-1): remove 2 itens, adiciona 1
-    const auto n_in = in_solution.size();
-    for (std::size_t i = 0; i < n_in; ++i)
+    if (speculative_pool_)
     {
-        for (std::size_t j = i + 1; j < n_in; ++j)
-        {
-            const int item_out1 = in_solution[i];
-            const int item_out2 = in_solution[j];
-
-            const int freed_weight = instance_.weights[item_out1] + instance_.weights[item_out2];
-            const int freed_profit = instance_.profits[item_out1] + instance_.profits[item_out2];
-
-            for (int item_in : out_solution)
-            {
-                // Só vale a pena se o item entrante tiver lucro maior
-                if (instance_.profits[item_in] <= freed_profit)
-                {
-                    continue;
-                }
-
-                const int new_weight = current_sol.total_weight - freed_weight + instance_.weights[item_in];
-
-                if (new_weight > instance_.capacity)
-                {
-                    continue;
-                }
-
-                // Verifica conflitos com itens restantes (excluindo os dois removidos)
-                bool has_conflict = false;
-                for (int remaining : current_sol.selected_items)
-                {
-                    if (remaining == item_out1 || remaining == item_out2)
-                    {
-                        continue;
-                    }
-                    if (instance_.hasConflict(item_in, remaining))
-                    {
-                        has_conflict = true;
-                        break;
-                    }
-                }
-
-                if (has_conflict)
-                {
-                    continue;
-                }
-
-                Solution neighbor = current_sol;
-                neighbor.removeItem(item_out1,
-                                    instance_.profits[item_out1],
-                                    instance_.weights[item_out1]);
-                neighbor.removeItem(item_out2,
-                                    instance_.profits[item_out2],
-                                    instance_.weights[item_out2]);
-                neighbor.addItem(item_in,
-                                 instance_.profits[item_in],
-                                 instance_.weights[item_in]);
-                neighbor.is_feasible = true;
-                neighborhood.push_back(std::move(neighbor));
-            }
-        }
+        std::cout << " [especulativo]";
     }
+    std::cout << ": "
+              << "Valor = " << current_sol.total_profit
+              << ", Iteracoes = " << stats_.iterations
+              << ", Melhorias = " << stats_.improvements
+              << ", Avaliacoes = " << stats_.evaluations
+              << " (" << std::scientific << std::setprecision(2) << rate << "/s)"
+              << ", Podados = " << stats_.pruned;
+    if (dont_look_bits_)
+    {
+        std::cout << ", Pulados = " << stats_.skipped;
+    }
+    std::cout << ", Tempo = " << std::fixed << std::setprecision(4)
+              << current_sol.computation_time << "s";
+    if (stats_.time_limit_reached)
+    {
+        std::cout << " [limite de tempo]";
+    }
+    std::cout << '\n';
 
-    return neighborhood;
+    return current_sol;
 }
 
-std::pair<Solution, bool> VND::exploreNeighborhood(
-    const Solution &current_sol,
-    NeighborhoodType type) const
+void VND::improve(Solution &current_sol, int max_iterations, const Deadline &deadline)
 {
-    std::vector<Solution> neighborhood;
+    stats_ = LocalSearchStats{};
+    moves_.resetEvaluations();
+    moves_.load(current_sol);
+    moves_.setDeadline(&deadline);
 
-    switch (type)
+    switch (order_)
     {
-    case NeighborhoodType::ADD_DROP:
-        neighborhood = generateAddDropNeighborhood(current_sol);
+    case NeighborhoodOrder::ADD_DROP_SWAP11_SWAP21:
+        descend<neighborhood::AddDrop, neighborhood::Swap11, neighborhood::Swap21>(current_sol, max_iterations, deadline);
         break;
-    case NeighborhoodType::SWAP_1_1:
-        neighborhood = generateSwap11Neighborhood(current_sol);
+    case NeighborhoodOrder::SWAP11_SWAP21_ADD_DROP:
+        descend<neighborhood::Swap11, neighborhood::Swap21, neighborhood::AddDrop>(current_sol, max_iterations, deadline);
         break;
-    case NeighborhoodType::SWAP_2_1:
-        neighborhood = generateSwap21Neighborhood(current_sol);
+    case NeighborhoodOrder::ADD_DROP_SWAP11:
+        descend<neighborhood::AddDrop, neighborhood::Swap11>(current_sol, max_iterations, deadline);
+        break;
+    case NeighborhoodOrder::EXTENDED:
+        descend<neighborhood::AddDrop, neighborhood::Swap11, neighborhood::Swap21,
+                neighborhood::Swap12, neighborhood::Swap22, neighborhood::EjectionChain>(current_sol, max_iterations,
+                                                                                       deadline);
         break;
     }
 
-    const Solution *best = nullptr;
-    for (const auto &neighbor : neighborhood)
-    {
-        if (neighbor.total_profit > current_sol.total_profit)
-        {
-            if (!best || neighbor.total_profit > best->total_profit)
-            {
-                best = &neighbor;
-            }
-        }
-    }
-
-    if (best != nullptr)
-    {
-        return {*best, true};
-    }
-    return {current_sol, false};
+    moves_.setDeadline(nullptr);
+    stats_.evaluations = moves_.evaluations();
+    stats_.pruned = moves_.pruned();
+    stats_.skipped = moves_.skipped();
 }
 
-Solution VND::solve(const Solution &initial_solution, int max_iterations)
+template <typename... Neighborhoods>
+void VND::descend(Solution &current_sol, int max_iterations, const Deadline &deadline)
 {
-    const auto start = std::chrono::steady_clock::now();
-
-    Solution current_sol = initial_solution;
-    current_sol.method_name = "VND";
+    constexpr int K = static_cast<int>(sizeof...(Neighborhoods));
 
     int iteration = 0;
     int k = 1; // Start with first neighborhood
     int improvements = 0;
+    bool verified = !dont_look_bits_; // Sem bits, esgotar a última vizinhança já prova o ótimo local
 
-    while (k <= 3 && iteration < max_iterations)
+    while (k <= K && iteration < max_iterations)
     {
-        auto type = static_cast<NeighborhoodType>(k);
-        auto [best_neighbor, found_improvement] = exploreNeighborhood(current_sol, type);
+        if (deadline.expired())
+        {
+            stats_.time_limit_reached = true;
+            break;
+        }
+
+        // Especulativo: as vizinhanças seguintes, até o limite de iterações, junto com a corrente
+        const int last = speculative_pool_ ? std::min(K, k + (max_iterations - iteration) - 1) : k;
+        const auto [found, best_move] = (last > k)
+                                            ? exploreSpeculative<Neighborhoods...>(k, last)
+                                            : std::pair{k, exploreAt<Neighborhoods...>(k)};
+        if (speculative_pool_)
+        {
+            settleMarks<Neighborhoods...>(best_move ? found : last);
+        }
 
-        if (found_improvement)
+        // Varredura interrompida pelo Deadline: não conta como vizinhança esgotada
+        if (!best_move && deadline.expired())
         {
-            current_sol = std::move(best_neighbor);
+            stats_.time_limit_reached = true;
+            break;
+        }
+
+        if (best_move)
+        {
+            iteration += found - k + 1; // Vizinhanças que a exploração sequencial teria visitado
+            moves_.apply(current_sol, *best_move);
             k = 1; // Reset to first neighborhood
             ++improvements;
+            verified = !dont_look_bits_;
         }
         else
         {
-            ++k; // Move to next neighborhood
+            iteration += last - k + 1;
+            k = last + 1; // Move to next neighborhood
+        }
+
+        // Os bits não enxergam mudanças globais (folga maior, item que ficou
+        // livre): uma passada completa confirma o ótimo local
+        if (k > K && !verified)
+        {
+            moves_.clearDontLookBits();
+            verified = true;
+            k = 1;
         }
-        ++iteration;
     }
 
-    const auto end = std::chrono::steady_clock::now();
-    const std::chrono::duration<double> elapsed = end - start;
-    current_sol.computation_time = elapsed.count();
+    stats_.iterations = iteration;
+    stats_.improvements = improvements;
+}
 
-    std::cout << "VND: "
-              << "Valor = " << current_sol.total_profit
-              << ", Iteracoes = " << iteration
-              << ", Melhorias = " << improvements
-              << ", Tempo = " << std::fixed << std::setprecision(4)
-              << current_sol.computation_time << "s\n";
+const LocalSearchStats &VND::lastStats() const noexcept
+{
+    return stats_;
+}
 
-    return current_sol;
+void VND::setPivotRule(PivotRule rule) noexcept
+{
+    pivot_rule_ = rule;
+    moves_.setPivotRule(rule);
+}
+
+void VND::setSeed(std::uint64_t seed) noexcept
+{
+    moves_.setSeed(seed);
+}
+
+void VND::setDontLookBits(bool enabled) noexcept
+{
+    dont_look_bits_ = enabled;
+    moves_.setDontLookBits(enabled);
+}
+
+void VND::setSpeculative(bool enabled)
+{
+    speculative_pool_.reset();
+    if (enabled)
+    {
+        // Vizinhanças além das duas seguintes esperam na fila (e quase sempre são canceladas)
+        speculative_pool_ = std::make_unique<ThreadPool>(2);
+    }
+    moves_.setDeferredMarks(enabled);
+}
+
+void VND::setParallel(bool enabled, unsigned int n_threads)
+{
+    moves_.setThreadPool(nullptr);
+    pool_.reset();
+    if (enabled)
+    {
+        pool_ = std::make_unique<ThreadPool>(n_threads);
+        moves_.setThreadPool(pool_.get());
+    }
+}
+
+void VND::setNeighborhoodOrder(NeighborhoodOrder order) noexcept
+{
+    order_ = order;
+}
+
+std::string_view VND::neighborhoodOrderToString(NeighborhoodOrder order) noexcept
+{
+    switch (order)
+    {
+    case NeighborhoodOrder::ADD_DROP_SWAP11_SWAP21:
+        return "AddDrop>Swap11>Swap21";
+    case NeighborhoodOrder::SWAP11_SWAP21_ADD_DROP:
+        return "Swap11>Swap21>AddDrop";
+    case NeighborhoodOrder::ADD_DROP_SWAP11:
+        return "AddDrop>Swap11";
+    case NeighborhoodOrder::EXTENDED:
+        return "AddDrop>Swap11>Swap21>Swap12>Swap22>EjectionChain";
+    }
+    return "Unknown";
 }
@@ -2,8 +2,11 @@
  * @file vnd.h
  * @brief Variable Neighborhood Descent (VND) para o DCKP
  *
- * Implementa o VND com três estruturas de vizinhança para escapar de ótimos
- * locais através da troca sistemática entre vizinhanças de força crescente.
+ * Implementa o VND com até seis estruturas de vizinhança (três na ordem
+ * padrão, seis na ordem EXTENDED) para escapar de ótimos locais através da
+ * troca sistemática entre vizinhanças de força crescente.
+ * A sequência de vizinhanças é uma lista de tipos (ver neighborhoods.h); as
+ * ordens usuais são escolhidas em tempo de execução por NeighborhoodOrder.
  *
  * @author Thalles e Luiz
  * @version 2.0
@@ -12,12 +15,30 @@
 #ifndef VND_H
 #define VND_H
 
+#include "../utils/deadline.h"
 #include "../utils/instance_reader.h"
 #include "../utils/solution.h"
-#include "../utils/validator.h"
+#include "local_search_stats.h"
+#include "move_engine.h"
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
 #include <utility>
-#include <vector>
+
+/**
+ * @enum NeighborhoodOrder
+ * @brief Sequência de vizinhanças do VND
+ */
+enum class NeighborhoodOrder
+{
+    ADD_DROP_SWAP11_SWAP21, ///< Add/Drop, Swap(1-1), Swap(2-1): força crescente (padrão)
+    SWAP11_SWAP21_ADD_DROP, ///< Swaps primeiro, Add/Drop só para fechar
+    ADD_DROP_SWAP11,        ///< Sem Swap(2-1): descida mais barata
+    EXTENDED                ///< Padrão seguido de Swap(1-2), Swap(2-2) e cadeias de ejeção
+};
 
 /**
  * @class VND
@@ -27,6 +48,11 @@
  *   N1 (Add/Drop): Adiciona ou remove um único item
  *   N2 (Swap 1-1): Troca um item dentro por um fora
  *   N3 (Swap 2-1): Remove dois itens para adicionar um (libera capacidade/conflitos)
+ * Na ordem EXTENDED, ainda:
+ *   N4 (Swap 1-2): Remove um item para adicionar dois compatíveis
+ *   N5 (Swap 2-2): Troca dois itens dentro por dois fora
+ *   N6 (Cadeia de ejeção): até três trocas/remoções combinadas, em que elos
+ *      que liberam peso viabilizam um elo de ganho
  */
 class VND
 {
@@ -42,65 +68,149 @@ public:
      *
      * @param initial_solution Solução inicial (tipicamente de um construtivo)
      * @param max_iterations Número máximo total de iterações entre todas as vizinhanças
+     * @param deadline Limite de tempo; consultado a cada iteração e dentro das varreduras
      * @return Melhor solução encontrada
      */
-    [[nodiscard]] Solution solve(const Solution &initial_solution, int max_iterations = 1000);
+    [[nodiscard]] Solution solve(const Solution &initial_solution, int max_iterations = 1000,
+                                 const Deadline &deadline = Deadline());
 
-private:
-    const DCKPInstance &instance_; ///< Referência para a instância
-    Validator validator_;          ///< Validador de soluções
+    /**
+     * @brief Aplica o VND sobre uma solução, sem imprimir resumo
+     *
+     * Usado quando a busca roda muitas vezes (ex.: GRASP + busca local):
+     * os buffers internos do MoveEngine são reaproveitados entre chamadas.
+     *
+     * @param current_sol Solução melhorada no lugar
+     * @param max_iterations Número máximo total de iterações entre todas as vizinhanças
+     * @param deadline Limite de tempo; consultado a cada iteração e dentro das varreduras
+     */
+    void improve(Solution &current_sol, int max_iterations = 1000,
+                 const Deadline &deadline = Deadline());
 
     /**
-     * @brief Tipos de vizinhança na ordem de exploração
+     * @brief Estatísticas da última chamada de solve()
+     * @return Iterações, melhorias e indicação de parada por tempo
+     * @note Válido após solve() ou improve()
      */
-    enum class NeighborhoodType
-    {
-        ADD_DROP = 1, ///< Vizinhança N1: adicionar ou remover item
-        SWAP_1_1 = 2, ///< Vizinhança N2: trocar 1 por 1
-        SWAP_2_1 = 3  ///< Vizinhança N3: remover 2, adicionar 1
-    };
+    [[nodiscard]] const LocalSearchStats &lastStats() const noexcept;
 
     /**
-     * @brief Gera a vizinhança Add/Drop (N1)
+     * @brief Define a regra de escolha do movimento (default: BEST_IMPROVEMENT)
+     * @param rule Regra de escolha
+     */
+    void setPivotRule(PivotRule rule) noexcept;
+
+    /**
+     * @brief Reinicia o gerador da ordem aleatória (SHUFFLED_FIRST_IMPROVEMENT)
+     * @param seed Semente
+     */
+    void setSeed(std::uint64_t seed) noexcept;
+
+    /**
+     * @brief Ativa a avaliação paralela das vizinhanças Swap
      *
-     * Tenta adicionar qualquer item viável ou remover qualquer item da solução.
+     * O laço externo da vizinhança é dividido entre as threads de um pool
+     * próprio; o movimento escolhido é o mesmo da execução sequencial.
      *
-     * @param current_sol Solução atual
-     * @return Vetor de soluções vizinhas
+     * @param enabled true para ativar
+     * @param n_threads Número de threads (0 = núcleos disponíveis)
      */
-    [[nodiscard]] std::vector<Solution> generateAddDropNeighborhood(const Solution &current_sol) const;
+    void setParallel(bool enabled, unsigned int n_threads = 0);
 
     /**
-     * @brief Gera a vizinhança Swap(1-1) (N2)
+     * @brief Ativa os don't-look bits nas vizinhanças Swap (default: desativados)
      *
-     * Troca padrão de um item dentro por um item fora.
+     * Depois de um movimento, só os itens na região afetada (movidos e
+     * parceiros de conflito dos vizinhos) voltam a ser varridos como itens
+     * que saem. Quando todas as vizinhanças falham, os bits são limpos e uma
+     * passada completa confirma o ótimo local.
      *
-     * @param current_sol Solução atual
-     * @return Vetor de soluções vizinhas
+     * @param enabled true para ativar
      */
-    [[nodiscard]] std::vector<Solution> generateSwap11Neighborhood(const Solution &current_sol) const;
+    void setDontLookBits(bool enabled) noexcept;
 
     /**
-     * @brief Gera a vizinhança Swap(2-1) (N3)
+     * @brief Ativa a exploração especulativa das vizinhanças
      *
-     * Remove dois itens da solução e adiciona um. Útil quando
-     * itens de alto lucro estão bloqueados por capacidade ou conflitos.
+     * A vizinhança corrente roda na thread chamadora e as seguintes, ao mesmo
+     * tempo, em um pool próprio. Vale o movimento da vizinhança de menor
+     * índice que melhora; as de índice maior são canceladas. As marcações
+     * de don't-look bits ficam adiadas e só valem as das vizinhanças que a
+     * exploração sequencial teria varrido, de modo que o movimento aceito e
+     * a contagem de iterações são os da exploração sequencial.
      *
-     * @param current_sol Solução atual
-     * @return Vetor de soluções vizinhas
+     * @note Avaliações, podados e pulados incluem o trabalho das varreduras
+     *       especulativas descartadas.
+     *
+     * @param enabled true para ativar
      */
-    [[nodiscard]] std::vector<Solution> generateSwap21Neighborhood(const Solution &current_sol) const;
+    void setSpeculative(bool enabled);
 
     /**
-     * @brief Explora uma vizinhança específica buscando a melhor melhoria
+     * @brief Define a sequência de vizinhanças (default: ADD_DROP_SWAP11_SWAP21)
+     * @param order Sequência
+     */
+    void setNeighborhoodOrder(NeighborhoodOrder order) noexcept;
+
+    /**
+     * @brief Converte NeighborhoodOrder para string
+     * @param order Sequência
+     * @return Vizinhanças separadas por '>' (ex.: "AddDrop>Swap11>Swap21")
+     */
+    [[nodiscard]] static std::string_view neighborhoodOrderToString(NeighborhoodOrder order) noexcept;
+
+private:
+    LocalSearchStats stats_;                       ///< Estatísticas da última execução
+    PivotRule pivot_rule_;                         ///< Regra de escolha do movimento
+    NeighborhoodOrder order_;                      ///< Sequência de vizinhanças
+    bool dont_look_bits_ = false;                  ///< Don't-look bits nas vizinhanças Swap
+    std::unique_ptr<ThreadPool> pool_;             ///< Pool da avaliação paralela (nullptr = sequencial)
+    std::unique_ptr<ThreadPool> speculative_pool_; ///< Pool das vizinhanças especulativas (nullptr = desativado)
+    MoveEngine moves_;                             ///< Avaliação das vizinhanças por movimentos
+
+    /**
+     * @brief Laço de descida especializado para uma sequência de vizinhanças
      *
-     * @param current_sol Solução atual
-     * @param type Vizinhança a explorar
-     * @return Par (melhor_solucao, encontrou_melhoria)
+     * A k-ésima vizinhança (k a partir de 1) é a k-ésima da lista; ao aceitar
+     * um movimento a descida volta para a primeira.
+     *
+     * @tparam Neighborhoods Vizinhanças de neighborhood (ver neighborhoods.h)
+     * @param current_sol Solução melhorada no lugar (já carregada em moves_)
+     * @param max_iterations Número máximo total de iterações entre todas as vizinhanças
+     * @param deadline Limite de tempo; consultado a cada iteração e dentro das varreduras
+     */
+    template <typename... Neighborhoods>
+    void descend(Solution &current_sol, int max_iterations, const Deadline &deadline);
+
+    /**
+     * @brief Explora a k-ésima vizinhança da lista
+     * @tparam Neighborhoods Sequência de vizinhanças
+     * @param k Índice da vizinhança (a partir de 1)
+     * @param cancel Flag de cancelamento repassado ao MoveEngine (nullptr = nenhum)
+     * @return Movimento que melhora sobre a solução carregada em moves_, ou std::nullopt
+     */
+    template <typename... Neighborhoods>
+    [[nodiscard]] std::optional<Move> exploreAt(int k, const std::atomic<bool> *cancel = nullptr);
+
+    /**
+     * @brief Resolve as marcações adiadas da exploração especulativa
+     * @tparam Neighborhoods Sequência de vizinhanças
+     * @param found Índice da vizinhança que melhorou; as marcações das
+     *              vizinhanças de índice maior são descartadas
+     */
+    template <typename... Neighborhoods>
+    void settleMarks(int found) noexcept;
+
+    /**
+     * @brief Explora as vizinhanças first..last ao mesmo tempo
+     * @tparam Neighborhoods Sequência de vizinhanças
+     * @param first Primeira vizinhança (roda na thread chamadora)
+     * @param last Última vizinhança
+     * @return Índice da vizinhança de menor índice que melhora (last + 1 se
+     *         nenhuma) e o seu movimento
      */
-    [[nodiscard]] std::pair<Solution, bool> exploreNeighborhood(
-        const Solution &current_sol,
-        NeighborhoodType type) const;
+    template <typename... Neighborhoods>
+    [[nodiscard]] std::pair<int, std::optional<Move>> exploreSpeculative(int first, int last);
 };
 
 #endif // VND_H
@@ -3,19 +3,22 @@
  * @brief Programa principal para experimentos com heurísticas e buscas locais do DCKP
  *
  * Este programa implementa um solver para o Disjunctively Constrained Knapsack Problem
- * usando heurísticas construtivas (Greedy, GRASP) e buscas locais (Hill Climbing, VND).
+ * usando heurísticas construtivas (Greedy, GRASP), buscas locais (Hill Climbing, VND)
+ * e Busca Tabu.
  *
  * @author Thalles e Luiz
  * @version 2.0
  */
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -23,8 +26,11 @@
 
 #include "constructive/grasp.h"
 #include "constructive/greedy.h"
+#include "constructive/item_order_cache.h"
 #include "local_search/hill_climbing.h"
+#include "local_search/tabu_search.h"
 #include "local_search/vnd.h"
+#include "utils/deadline.h"
 #include "utils/instance_reader.h"
 #include "utils/solution.h"
 #include "utils/validator.h"
@@ -39,8 +45,35 @@ namespace config
 {
     constexpr int GRASP_ITERATIONS = 100;
     constexpr double GRASP_ALPHA = 0.3;
+    constexpr RCLType GRASP_RCL = RCLType::VALUE; // CARDINALITY: os melhores 1 + alpha * (n - 1)
+    constexpr bool GRASP_PARALLEL = false;    // Iterações em paralelo (resultado independe das threads)
+    constexpr unsigned int GRASP_THREADS = 0; // 0 = todos os núcleos disponíveis
+    constexpr RngEngine GRASP_RNG = RngEngine::XOSHIRO256; // MT19937 reproduz resultados antigos
+    constexpr bool GRASP_REACTIVE = false; // Executa também o GRASP reativo (alpha adaptativo)
+    constexpr std::array<double, 9> GRASP_REACTIVE_ALPHAS = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9};
+    constexpr GRASPLocalSearch GRASP_LOCAL_SEARCH = GRASPLocalSearch::NONE; // Busca local nas construções
+    constexpr int GRASP_LS_TOP_K = 0;      // 0 = toda construção; k > 0 = só as k melhores
+    constexpr int GRASP_LS_MAX_ITER = 100; // Iterações de cada busca local do GRASP
+    constexpr PathRelinkingMode GRASP_PATH_RELINKING = PathRelinkingMode::NONE; // Path relinking com elite
+    constexpr int GRASP_ELITE_SIZE = 10;         // Membros do conjunto elite
+    constexpr int GRASP_ELITE_MIN_DISTANCE = 4;  // Distância de Hamming mínima no conjunto elite
+    constexpr bool GRASP_DUPLICATE_FILTER = false; // Evita busca local em construções repetidas
+    constexpr PivotRule LOCAL_SEARCH_PIVOT = PivotRule::BEST_IMPROVEMENT; // Regra de escolha de HC, VND e GRASP+LS
+    constexpr bool LOCAL_SEARCH_PARALLEL = false; // Vizinhanças Swap de HC e VND divididas entre threads
+    constexpr unsigned int LOCAL_SEARCH_THREADS = 0; // 0 = núcleos disponíveis
     constexpr int HILL_CLIMBING_MAX_ITER = 100;
     constexpr int VND_MAX_ITER = 1000;
+    constexpr bool VND_DONT_LOOK_BITS = true;        // Pula itens sem melhoria fora da região do último movimento
+    constexpr bool VND_SPECULATIVE = false;          // Explora as vizinhanças seguintes em paralelo com a corrente
+    constexpr NeighborhoodOrder VND_ORDER = NeighborhoodOrder::ADD_DROP_SWAP11_SWAP21; // Sequência de vizinhanças do VND (EXTENDED inclui Swap 1-2/2-2 e cadeias de ejeção)
+    constexpr double GRASP_TIME_LIMIT = 0.0;         // Segundos por execução (0 = sem limite)
+    constexpr double HILL_CLIMBING_TIME_LIMIT = 0.0; // Segundos por execução (0 = sem limite)
+    constexpr double VND_TIME_LIMIT = 0.0;           // Segundos por execução (0 = sem limite)
+    constexpr int TABU_MAX_ITER = 20000;
+    constexpr int TABU_TENURE = 7;                   // Iterações mínimas em que um item movido fica proibido
+    constexpr int TABU_TENURE_SPREAD = 8;            // Acréscimo sorteado em [0, spread] sobre a tenure
+    constexpr double TABU_TIME_LIMIT = 2.0;          // Orçamento de tempo da Busca Tabu em segundos
+    constexpr bool TABU_LOG_TRACE = true;            // Imprime a trajetória de melhorias da Busca Tabu
     constexpr int CSV_TIME_PRECISION = 6;
 }
 
@@ -158,7 +191,7 @@ void printSeparator(char ch = '-', int width = 40)
     const std::string &name)
 {
     std::vector<ExperimentResult> results;
-    results.reserve(8);
+    results.reserve(10);
 
     printSeparator();
     std::cout << "Instancia: " << name << '\n';
@@ -173,12 +206,15 @@ void printSeparator(char ch = '-', int width = 40)
 
     instance.print();
 
+    // Ordenações de itens compartilhadas entre Guloso e GRASP
+    auto orders = std::make_shared<ItemOrderCache>(instance);
+
     // ETAPA 1: Heurísticas Construtivas
     std::cout << "\n--- ETAPA 1: Heuristicas Construtivas ---\n";
 
     // Greedy
     std::cout << "\n[Guloso]\n";
-    GreedyConstructive greedy(instance);
+    GreedyConstructive greedy(instance, orders);
     auto greedy_solutions = greedy.constructAll();
 
     for (const auto &sol : greedy_solutions)
@@ -188,25 +224,59 @@ void printSeparator(char ch = '-', int width = 40)
 
     // GRASP
     std::cout << "\n[GRASP]\n";
-    GRASPConstructive grasp(instance);
-    Solution grasp_sol = grasp.solve(config::GRASP_ITERATIONS, config::GRASP_ALPHA);
+    GRASPConstructive grasp(instance, orders);
+    grasp.setParallel(config::GRASP_PARALLEL, config::GRASP_THREADS);
+    grasp.setRngEngine(config::GRASP_RNG);
+    grasp.setRCLType(config::GRASP_RCL);
+    grasp.setDuplicateFilter(config::GRASP_DUPLICATE_FILTER);
+    grasp.setLocalSearch(config::GRASP_LOCAL_SEARCH, config::GRASP_LS_TOP_K, config::GRASP_LS_MAX_ITER,
+                         config::LOCAL_SEARCH_PIVOT);
+    grasp.setPathRelinking(config::GRASP_PATH_RELINKING, config::GRASP_ELITE_SIZE, config::GRASP_ELITE_MIN_DISTANCE);
+    Solution grasp_sol = grasp.solve(config::GRASP_ITERATIONS, config::GRASP_ALPHA,
+                                     Deadline::after(config::GRASP_TIME_LIMIT));
     results.push_back(solutionToResult(name, grasp_sol));
 
+    if constexpr (config::GRASP_REACTIVE)
+    {
+        std::cout << "\n[GRASP Reativo]\n";
+        Solution reactive_sol = grasp.solveReactive(config::GRASP_ITERATIONS, config::GRASP_REACTIVE_ALPHAS,
+                                                    Deadline::after(config::GRASP_TIME_LIMIT));
+        results.push_back(solutionToResult(name, reactive_sol));
+    }
+
     // ETAPA 2: Buscas Locais
     std::cout << "\n--- ETAPA 2: Buscas Locais ---\n";
 
     // Hill Climbing
     std::cout << "\n[Hill Climbing]\n";
     HillClimbing hc(instance);
-    Solution hc_sol = hc.solve(grasp_sol, config::HILL_CLIMBING_MAX_ITER);
+    hc.setPivotRule(config::LOCAL_SEARCH_PIVOT);
+    hc.setParallel(config::LOCAL_SEARCH_PARALLEL, config::LOCAL_SEARCH_THREADS);
+    Solution hc_sol = hc.solve(grasp_sol, config::HILL_CLIMBING_MAX_ITER,
+                               Deadline::after(config::HILL_CLIMBING_TIME_LIMIT));
     results.push_back(solutionToResult(name, hc_sol));
 
     // VND
     std::cout << "\n[VND]\n";
     VND vnd(instance);
-    Solution vnd_sol = vnd.solve(grasp_sol, config::VND_MAX_ITER);
+    vnd.setPivotRule(config::LOCAL_SEARCH_PIVOT);
+    vnd.setParallel(config::LOCAL_SEARCH_PARALLEL, config::LOCAL_SEARCH_THREADS);
+    vnd.setDontLookBits(config::VND_DONT_LOOK_BITS);
+    vnd.setSpeculative(config::VND_SPECULATIVE);
+    vnd.setNeighborhoodOrder(config::VND_ORDER);
+    Solution vnd_sol = vnd.solve(grasp_sol, config::VND_MAX_ITER,
+                                 Deadline::after(config::VND_TIME_LIMIT));
     results.push_back(solutionToResult(name, vnd_sol));
 
+    // Busca Tabu
+    std::cout << "\n[Busca Tabu]\n";
+    TabuSearch tabu(instance);
+    tabu.setTenure(config::TABU_TENURE, config::TABU_TENURE_SPREAD);
+    tabu.setTraceLog(config::TABU_LOG_TRACE);
+    Solution tabu_sol = tabu.solve(grasp_sol, config::TABU_MAX_ITER,
+                                   Deadline::after(config::TABU_TIME_LIMIT));
+    results.push_back(solutionToResult(name, tabu_sol));
+
     // Resumo
     auto best = std::ranges::max_element(results, {},
                                          [](const ExperimentResult &r)
@@ -225,7 +295,7 @@ void printSeparator(char ch = '-', int width = 40)
     const std::string &name)
 {
     std::vector<ExperimentResult> results;
-    results.reserve(5);
+    results.reserve(7);
 
     printSeparator();
     std::cout << "Instancia: " << name << '\n';
@@ -239,11 +309,15 @@ void printSeparator(char ch = '-', int width = 40)
     }
 
     instance.print();
+
+    // Ordenações de itens compartilhadas entre Guloso e GRASP
+    auto orders = std::make_shared<ItemOrderCache>(instance);
+
     std::cout << "\n--- ETAPA 1: Heuristicas Construtivas ---\n";
 
     // Greedy (todas as estratégias)
     std::cout << "\n[Guloso]\n";
-    GreedyConstructive greedy(instance);
+    GreedyConstructive greedy(instance, orders);
     auto greedy_solutions = greedy.constructAll();
 
     for (const auto &sol : greedy_solutions)
@@ -253,10 +327,26 @@ void printSeparator(char ch = '-', int width = 40)
 
     // GRASP
     std::cout << "\n[GRASP]\n";
-    GRASPConstructive grasp(instance);
-    Solution grasp_sol = grasp.solve(config::GRASP_ITERATIONS, config::GRASP_ALPHA);
+    GRASPConstructive grasp(instance, orders);
+    grasp.setParallel(config::GRASP_PARALLEL, config::GRASP_THREADS);
+    grasp.setRngEngine(config::GRASP_RNG);
+    grasp.setRCLType(config::GRASP_RCL);
+    grasp.setDuplicateFilter(config::GRASP_DUPLICATE_FILTER);
+    grasp.setLocalSearch(config::GRASP_LOCAL_SEARCH, config::GRASP_LS_TOP_K, config::GRASP_LS_MAX_ITER,
+                         config::LOCAL_SEARCH_PIVOT);
+    grasp.setPathRelinking(config::GRASP_PATH_RELINKING, config::GRASP_ELITE_SIZE, config::GRASP_ELITE_MIN_DISTANCE);
+    Solution grasp_sol = grasp.solve(config::GRASP_ITERATIONS, config::GRASP_ALPHA,
+                                     Deadline::after(config::GRASP_TIME_LIMIT));
     results.push_back(solutionToResult(name, grasp_sol));
 
+    if constexpr (config::GRASP_REACTIVE)
+    {
+        std::cout << "\n[GRASP Reativo]\n";
+        Solution reactive_sol = grasp.solveReactive(config::GRASP_ITERATIONS, config::GRASP_REACTIVE_ALPHAS,
+                                                    Deadline::after(config::GRASP_TIME_LIMIT));
+        results.push_back(solutionToResult(name, reactive_sol));
+    }
+
     // Resumo
     auto best = std::ranges::max_element(results, {},
                                          [](const ExperimentResult &r)
@@ -269,14 +359,14 @@ void printSeparator(char ch = '-', int width = 40)
 
 /**
  * @brief Processa instância executando apenas Etapa 2 (Buscas Locais)
- * @note Utiliza GRASP para gerar solução inicial e aplica HC + VND
+ * @note Utiliza GRASP para gerar solução inicial e aplica HC, VND e Busca Tabu
  */
 [[nodiscard]] std::vector<ExperimentResult> processInstanceEtapa2(
     const std::string &path,
     const std::string &name)
 {
     std::vector<ExperimentResult> results;
-    results.reserve(3);
+    results.reserve(4);
 
     printSeparator();
     std::cout << "Instancia: " << name << '\n';
@@ -295,22 +385,48 @@ void printSeparator(char ch = '-', int width = 40)
     // GRASP para gerar solução inicial
     std::cout << "\n[GRASP - Solucao Inicial]\n";
     GRASPConstructive grasp(instance);
-    Solution grasp_sol = grasp.solve(config::GRASP_ITERATIONS, config::GRASP_ALPHA);
+    grasp.setParallel(config::GRASP_PARALLEL, config::GRASP_THREADS);
+    grasp.setRngEngine(config::GRASP_RNG);
+    grasp.setRCLType(config::GRASP_RCL);
+    grasp.setDuplicateFilter(config::GRASP_DUPLICATE_FILTER);
+    grasp.setLocalSearch(config::GRASP_LOCAL_SEARCH, config::GRASP_LS_TOP_K, config::GRASP_LS_MAX_ITER,
+                         config::LOCAL_SEARCH_PIVOT);
+    grasp.setPathRelinking(config::GRASP_PATH_RELINKING, config::GRASP_ELITE_SIZE, config::GRASP_ELITE_MIN_DISTANCE);
+    Solution grasp_sol = grasp.solve(config::GRASP_ITERATIONS, config::GRASP_ALPHA,
+                                     Deadline::after(config::GRASP_TIME_LIMIT));
     results.push_back({name, "GRASP_Inicial", grasp_sol.total_profit, grasp_sol.total_weight,
                        grasp_sol.size(), grasp_sol.computation_time, grasp_sol.is_feasible});
 
     // Hill Climbing
     std::cout << "\n[Hill Climbing]\n";
     HillClimbing hc(instance);
-    Solution hc_sol = hc.solve(grasp_sol, config::HILL_CLIMBING_MAX_ITER);
+    hc.setPivotRule(config::LOCAL_SEARCH_PIVOT);
+    hc.setParallel(config::LOCAL_SEARCH_PARALLEL, config::LOCAL_SEARCH_THREADS);
+    Solution hc_sol = hc.solve(grasp_sol, config::HILL_CLIMBING_MAX_ITER,
+                               Deadline::after(config::HILL_CLIMBING_TIME_LIMIT));
     results.push_back(solutionToResult(name, hc_sol));
 
     // VND
     std::cout << "\n[VND]\n";
     VND vnd(instance);
-    Solution vnd_sol = vnd.solve(grasp_sol, config::VND_MAX_ITER);
+    vnd.setPivotRule(config::LOCAL_SEARCH_PIVOT);
+    vnd.setParallel(config::LOCAL_SEARCH_PARALLEL, config::LOCAL_SEARCH_THREADS);
+    vnd.setDontLookBits(config::VND_DONT_LOOK_BITS);
+    vnd.setSpeculative(config::VND_SPECULATIVE);
+    vnd.setNeighborhoodOrder(config::VND_ORDER);
+    Solution vnd_sol = vnd.solve(grasp_sol, config::VND_MAX_ITER,
+                                 Deadline::after(config::VND_TIME_LIMIT));
     results.push_back(solutionToResult(name, vnd_sol));
 
+    // Busca Tabu
+    std::cout << "\n[Busca Tabu]\n";
+    TabuSearch tabu(instance);
+    tabu.setTenure(config::TABU_TENURE, config::TABU_TENURE_SPREAD);
+    tabu.setTraceLog(config::TABU_LOG_TRACE);
+    Solution tabu_sol = tabu.solve(grasp_sol, config::TABU_MAX_ITER,
+                                   Deadline::after(config::TABU_TIME_LIMIT));
+    results.push_back(solutionToResult(name, tabu_sol));
+
     // Resumo
     auto best = std::ranges::max_element(results, {},
                                          [](const ExperimentResult &r)
@@ -400,7 +516,7 @@ void printUsage(std::string_view prog)
               << "  single <arquivo> [csv]          Processa uma instancia (todas as etapas)\n"
               << "  batch <diretorio> <csv>         Processa todas as instancias (todas as etapas)\n"
               << "  batch-etapa1 <diretorio> <csv>  Processa apenas Etapa 1 (Greedy + GRASP)\n"
-              << "  batch-etapa2 <diretorio> <csv>  Processa apenas Etapa 2 (GRASP + HC + VND)\n\n"
+              << "  batch-etapa2 <diretorio> <csv>  Processa apenas Etapa 2 (GRASP + HC + VND + Tabu)\n\n"
               << "Exemplos:\n"
               << "  " << prog << " single DCKP-instances/.../1I1\n"
               << "  " << prog << " batch DCKP-instances/... results/results.csv\n"
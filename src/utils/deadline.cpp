@@ -0,0 +1,44 @@
+/**
+ * @file deadline.cpp
+ * @brief Implementação da classe Deadline
+ */
+
+#include "deadline.h"
+
+#include <algorithm>
+#include <limits>
+
+Deadline::Deadline() noexcept
+    : end_(Clock::time_point::max()), unlimited_(true) {}
+
+Deadline Deadline::after(double seconds) noexcept
+{
+    Deadline deadline;
+    if (seconds > 0.0)
+    {
+        deadline.unlimited_ = false;
+        deadline.end_ = Clock::now() +
+                        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    }
+    return deadline;
+}
+
+bool Deadline::expired() const noexcept
+{
+    return !unlimited_ && Clock::now() >= end_;
+}
+
+bool Deadline::unlimited() const noexcept
+{
+    return unlimited_;
+}
+
+double Deadline::remaining() const noexcept
+{
+    if (unlimited_)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    const std::chrono::duration<double> left = end_ - Clock::now();
+    return std::max(0.0, left.count());
+}
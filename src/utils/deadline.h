@@ -0,0 +1,63 @@
+/**
+ * @file deadline.h
+ * @brief Critério de parada por tempo de relógio (wall-clock)
+ *
+ * Um Deadline representa um instante limite em std::chrono::steady_clock.
+ * É imutável após criado e pode ser consultado de várias threads.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+#include <chrono>
+
+/**
+ * @class Deadline
+ * @brief Instante limite para métodos de busca
+ *
+ * O Deadline padrão não tem limite: expired() retorna false sem ler o relógio.
+ */
+class Deadline
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Construtor padrão (sem limite de tempo)
+     */
+    Deadline() noexcept;
+
+    /**
+     * @brief Cria um Deadline a partir de agora
+     * @param seconds Tempo disponível em segundos (<= 0 → sem limite)
+     * @return Deadline correspondente
+     */
+    [[nodiscard]] static Deadline after(double seconds) noexcept;
+
+    /**
+     * @brief Verifica se o instante limite já passou
+     * @return true se o tempo acabou
+     */
+    [[nodiscard]] bool expired() const noexcept;
+
+    /**
+     * @brief Indica se há limite de tempo
+     * @return true se o Deadline nunca expira
+     */
+    [[nodiscard]] bool unlimited() const noexcept;
+
+    /**
+     * @brief Tempo restante em segundos
+     * @return Segundos até o limite (0 se expirado, infinito se sem limite)
+     */
+    [[nodiscard]] double remaining() const noexcept;
+
+private:
+    Clock::time_point end_; ///< Instante limite
+    bool unlimited_;        ///< Sem limite de tempo
+};
+
+#endif // DEADLINE_H
@@ -0,0 +1,60 @@
+/**
+ * @file fenwick_tree.cpp
+ * @brief Implementação da classe FenwickTree
+ */
+
+#include "fenwick_tree.h"
+
+#include <cstddef>
+
+void FenwickTree::resetOnes(int n)
+{
+    size_ = n;
+    tree_.assign(static_cast<std::size_t>(n) + 1, 0);
+
+    // Construção linear: cada nó cobre (i & -i) posições de valor 1
+    for (int i = 1; i <= n; ++i)
+    {
+        tree_[static_cast<std::size_t>(i)] = i & -i;
+    }
+
+    top_bit_ = 1;
+    while (top_bit_ * 2 <= n)
+    {
+        top_bit_ *= 2;
+    }
+}
+
+void FenwickTree::add(int i, int delta) noexcept
+{
+    for (int x = i + 1; x <= size_; x += x & -x)
+    {
+        tree_[static_cast<std::size_t>(x)] += delta;
+    }
+}
+
+int FenwickTree::prefixSum(int i) const noexcept
+{
+    int sum = 0;
+    for (int x = i + 1; x > 0; x -= x & -x)
+    {
+        sum += tree_[static_cast<std::size_t>(x)];
+    }
+    return sum;
+}
+
+int FenwickTree::findKth(int k) const noexcept
+{
+    // Descida binária: acumula nós enquanto a soma não ultrapassa k
+    int pos = 0;
+    for (int step = top_bit_; step > 0; step /= 2)
+    {
+        const int next = pos + step;
+        if (next <= size_ && tree_[static_cast<std::size_t>(next)] <= k)
+        {
+            pos = next;
+            k -= tree_[static_cast<std::size_t>(next)];
+        }
+    }
+    return pos; // posição base 1 "pos + 1" convertida para base 0
+}
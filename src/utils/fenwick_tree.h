@@ -0,0 +1,64 @@
+/**
+ * @file fenwick_tree.h
+ * @brief Árvore de Fenwick (Binary Indexed Tree) para contagens por posição
+ *
+ * Usada para manter conjuntos de posições ativas com remoção, contagem de
+ * prefixo e seleção do k-ésimo ativo em O(log n).
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef FENWICK_TREE_H
+#define FENWICK_TREE_H
+
+#include <vector>
+
+/**
+ * @class FenwickTree
+ * @brief Somas de prefixo com atualização pontual sobre inteiros
+ */
+class FenwickTree
+{
+public:
+    /**
+     * @brief Construtor padrão (árvore vazia)
+     */
+    FenwickTree() noexcept = default;
+
+    /**
+     * @brief Reinicia a árvore com n posições, todas com valor 1
+     * @param n Número de posições
+     * @note Complexidade: O(n), reaproveita a memória já alocada
+     */
+    void resetOnes(int n);
+
+    /**
+     * @brief Soma delta à posição i
+     * @param i Posição (base 0)
+     * @param delta Valor a somar
+     */
+    void add(int i, int delta) noexcept;
+
+    /**
+     * @brief Soma das posições [0, i]
+     * @param i Posição final inclusiva (base 0); i < 0 retorna 0
+     * @return Soma do prefixo
+     */
+    [[nodiscard]] int prefixSum(int i) const noexcept;
+
+    /**
+     * @brief Encontra a menor posição p com prefixSum(p) > k
+     * @param k Índice (base 0) do elemento desejado entre os de valor 1
+     * @return Posição do k-ésimo elemento ativo
+     * @pre Valores 0/1 e 0 <= k < prefixSum(n - 1)
+     */
+    [[nodiscard]] int findKth(int k) const noexcept;
+
+private:
+    std::vector<int> tree_; ///< Árvore indexada em base 1
+    int size_ = 0;          ///< Número de posições
+    int top_bit_ = 0;       ///< Maior potência de 2 <= size_
+};
+
+#endif // FENWICK_TREE_H
@@ -0,0 +1,69 @@
+/**
+ * @file min_segment_tree.cpp
+ * @brief Implementação da classe MinSegmentTree
+ */
+
+#include "min_segment_tree.h"
+
+#include <algorithm>
+#include <cstddef>
+
+void MinSegmentTree::assign(std::span<const int> values)
+{
+    size_ = static_cast<int>(values.size());
+    leaves_ = 1;
+    while (leaves_ < size_)
+    {
+        leaves_ *= 2;
+    }
+
+    const auto leaves = static_cast<std::size_t>(leaves_);
+    tree_.assign(2 * leaves, EMPTY);
+    std::ranges::copy(values, tree_.begin() + static_cast<std::ptrdiff_t>(leaves));
+    for (std::size_t k = leaves - 1; k > 0; --k)
+    {
+        tree_[k] = std::min(tree_[2 * k], tree_[2 * k + 1]);
+    }
+}
+
+void MinSegmentTree::update(int i, int value) noexcept
+{
+    auto k = static_cast<std::size_t>(i + leaves_);
+    tree_[k] = value;
+    for (k /= 2; k > 0; k /= 2)
+    {
+        tree_[k] = std::min(tree_[2 * k], tree_[2 * k + 1]);
+    }
+}
+
+int MinSegmentTree::findFirst(int from, int limit) const noexcept
+{
+    // Raiz acima do limite: nenhuma posição serve
+    if (from >= size_ || tree_[1] > limit)
+    {
+        return -1;
+    }
+
+    // A partir do início, a raiz já cobre a resposta; senão sobe enquanto o
+    // nó não tem valor <= limit, passando ao vizinho da direita. O primeiro
+    // nó que tem desce pelo filho mais à esquerda
+    auto k = (from == 0) ? std::size_t{1} : static_cast<std::size_t>(from + leaves_);
+    while (tree_[k] > limit)
+    {
+        while (k % 2 == 1)
+        {
+            k /= 2;
+            if (k == 0)
+            {
+                return -1;
+            }
+        }
+        ++k;
+    }
+    const auto leaves = static_cast<std::size_t>(leaves_);
+    while (k < leaves)
+    {
+        k = (tree_[2 * k] <= limit) ? 2 * k : 2 * k + 1;
+    }
+    return static_cast<int>(k - leaves);
+}
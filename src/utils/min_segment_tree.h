@@ -0,0 +1,62 @@
+/**
+ * @file min_segment_tree.h
+ * @brief Árvore de segmentos de mínimo com busca da primeira posição abaixo de um limite
+ *
+ * Usada para manter um conjunto de posições com pesos (as ausentes valem
+ * EMPTY) e achar, em O(log n), a primeira posição a partir de uma dada cujo
+ * peso não passa de um limite.
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef MIN_SEGMENT_TREE_H
+#define MIN_SEGMENT_TREE_H
+
+#include <limits>
+#include <span>
+#include <vector>
+
+/**
+ * @class MinSegmentTree
+ * @brief Mínimo por intervalo com atualização pontual sobre inteiros
+ */
+class MinSegmentTree
+{
+public:
+    static constexpr int EMPTY = std::numeric_limits<int>::max(); ///< Valor de uma posição ausente
+
+    /**
+     * @brief Construtor padrão (árvore vazia)
+     */
+    MinSegmentTree() noexcept = default;
+
+    /**
+     * @brief Reinicia a árvore com os valores dados
+     * @param values Valor de cada posição (EMPTY = ausente)
+     * @note Complexidade: O(n), reaproveita a memória já alocada
+     */
+    void assign(std::span<const int> values);
+
+    /**
+     * @brief Define o valor da posição i
+     * @param i Posição (base 0)
+     * @param value Novo valor (EMPTY = ausente)
+     */
+    void update(int i, int value) noexcept;
+
+    /**
+     * @brief Encontra a menor posição p >= from com valor <= limit
+     * @param from Posição inicial (base 0)
+     * @param limit Maior valor aceito (< EMPTY)
+     * @return Posição encontrada, ou -1 se nenhuma
+     */
+    [[nodiscard]] int findFirst(int from, int limit) const noexcept;
+
+private:
+    std::vector<int> tree_; ///< Nó k cobre os filhos 2k e 2k + 1; folhas a partir de leaves_
+    int size_ = 0;          ///< Número de posições
+    int leaves_ = 1;        ///< Menor potência de 2 >= size_
+};
+
+#endif // MIN_SEGMENT_TREE_H
@@ -0,0 +1,70 @@
+/**
+ * @file packed_bitset.cpp
+ * @brief Implementação da classe PackedBitset
+ */
+
+#include "packed_bitset.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+namespace
+{
+    constexpr int WORD_BITS = 64;
+
+    [[nodiscard]] constexpr std::size_t wordOf(int i) noexcept
+    {
+        return static_cast<std::size_t>(i) / WORD_BITS;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t maskOf(int i) noexcept
+    {
+        return std::uint64_t{1} << (static_cast<unsigned int>(i) % WORD_BITS);
+    }
+} // namespace
+
+PackedBitset::PackedBitset(int n)
+    : words_((static_cast<std::size_t>(std::max(n, 0)) + WORD_BITS - 1) / WORD_BITS, 0),
+      size_(std::max(n, 0)) {}
+
+void PackedBitset::set(int i) noexcept
+{
+    words_[wordOf(i)] |= maskOf(i);
+}
+
+void PackedBitset::reset(int i) noexcept
+{
+    words_[wordOf(i)] &= ~maskOf(i);
+}
+
+bool PackedBitset::test(int i) const noexcept
+{
+    return (words_[wordOf(i)] & maskOf(i)) != 0;
+}
+
+int PackedBitset::count() const noexcept
+{
+    int total = 0;
+    for (const std::uint64_t word : words_)
+    {
+        total += std::popcount(word);
+    }
+    return total;
+}
+
+int PackedBitset::size() const noexcept
+{
+    return size_;
+}
+
+int PackedBitset::distance(const PackedBitset &a, const PackedBitset &b) noexcept
+{
+    const std::size_t n_words = std::min(a.words_.size(), b.words_.size());
+    int total = 0;
+    for (std::size_t w = 0; w < n_words; ++w)
+    {
+        total += std::popcount(a.words_[w] ^ b.words_[w]);
+    }
+    return total;
+}
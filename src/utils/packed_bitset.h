@@ -0,0 +1,80 @@
+/**
+ * @file packed_bitset.h
+ * @brief Conjunto de itens como vetor de bits compactado em palavras de 64 bits
+ *
+ * Usado para comparar soluções: a distância de Hamming entre dois conjuntos
+ * é a contagem de bits (popcount) do XOR palavra a palavra, em O(n / 64).
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef PACKED_BITSET_H
+#define PACKED_BITSET_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class PackedBitset
+ * @brief Vetor de bits de tamanho fixo
+ */
+class PackedBitset
+{
+public:
+    /**
+     * @brief Construtor padrão (conjunto vazio de tamanho 0)
+     */
+    PackedBitset() noexcept = default;
+
+    /**
+     * @brief Construtor
+     * @param n Número de posições, todas inicialmente 0
+     */
+    explicit PackedBitset(int n);
+
+    /**
+     * @brief Liga o bit i
+     * @param i Posição (base 0)
+     */
+    void set(int i) noexcept;
+
+    /**
+     * @brief Desliga o bit i
+     * @param i Posição (base 0)
+     */
+    void reset(int i) noexcept;
+
+    /**
+     * @brief Consulta o bit i
+     * @param i Posição (base 0)
+     * @return true se o bit está ligado
+     */
+    [[nodiscard]] bool test(int i) const noexcept;
+
+    /**
+     * @brief Número de bits ligados
+     * @return Popcount do conjunto
+     */
+    [[nodiscard]] int count() const noexcept;
+
+    /**
+     * @brief Número de posições
+     * @return Tamanho do conjunto
+     */
+    [[nodiscard]] int size() const noexcept;
+
+    /**
+     * @brief Distância de Hamming entre dois conjuntos do mesmo tamanho
+     * @param a Primeiro conjunto
+     * @param b Segundo conjunto
+     * @return Número de posições em que diferem
+     */
+    [[nodiscard]] static int distance(const PackedBitset &a, const PackedBitset &b) noexcept;
+
+private:
+    std::vector<std::uint64_t> words_; ///< Bits compactados (bit i na palavra i / 64)
+    int size_ = 0;                     ///< Número de posições
+};
+
+#endif // PACKED_BITSET_H
@@ -0,0 +1,55 @@
+/**
+ * @file random_engine.cpp
+ * @brief Implementação da semeadura dos geradores pseudoaleatórios
+ */
+
+#include "random_engine.h"
+
+namespace prng
+{
+    Xoshiro256StarStar::Xoshiro256StarStar(std::uint64_t seed) noexcept
+        : state_{}
+    {
+        this->seed(seed);
+    }
+
+    void Xoshiro256StarStar::seed(std::uint64_t seed) noexcept
+    {
+        // Saídas consecutivas de SplitMix64: nunca geram o estado todo zero
+        for (auto &word : state_)
+        {
+            word = splitmix64(seed);
+            seed += 0x9E3779B97F4A7C15ull;
+        }
+    }
+
+    Pcg32::Pcg32(std::uint64_t seed, std::uint64_t stream) noexcept
+        : state_(0), increment_(1)
+    {
+        this->seed(seed, stream);
+    }
+
+    void Pcg32::seed(std::uint64_t seed, std::uint64_t stream) noexcept
+    {
+        // Inicialização de referência (pcg32_srandom_r)
+        state_ = 0;
+        increment_ = (stream << 1) | 1u;
+        (*this)();
+        state_ += seed;
+        (*this)();
+    }
+
+    std::string_view engineName(RngEngine engine) noexcept
+    {
+        switch (engine)
+        {
+        case RngEngine::XOSHIRO256:
+            return "Xoshiro256**";
+        case RngEngine::PCG32:
+            return "PCG32";
+        case RngEngine::MT19937:
+            return "MT19937";
+        }
+        return "Unknown";
+    }
+} // namespace prng
@@ -0,0 +1,190 @@
+/**
+ * @file random_engine.h
+ * @brief Geradores pseudoaleatórios rápidos para os componentes aleatorizados
+ *
+ * Fornece geradores de estado pequeno (xoshiro256**, PCG32), compatíveis com
+ * UniformRandomBitGenerator, amostragem inteira limitada sem viés
+ * (método de Lemire).
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef RANDOM_ENGINE_H
+#define RANDOM_ENGINE_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @enum RngEngine
+ * @brief Gerador usado por um componente aleatorizado
+ */
+enum class RngEngine
+{
+    XOSHIRO256, ///< xoshiro256** (32 bytes de estado, default)
+    PCG32,      ///< PCG32 XSH-RR (16 bytes de estado, fluxos selecionáveis)
+    MT19937     ///< std::mt19937 + uniform_int_distribution (reproduz resultados antigos)
+};
+
+namespace prng
+{
+    /**
+     * @brief Mistura SplitMix64 (Steele et al.), usada para derivar sementes
+     */
+    [[nodiscard]] constexpr std::uint64_t splitmix64(std::uint64_t x) noexcept
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @class Xoshiro256StarStar
+     * @brief Gerador xoshiro256** (Blackman e Vigna), período 2^256 - 1
+     */
+    class Xoshiro256StarStar
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        /**
+         * @brief Construtor
+         * @param seed Semente (expandida para os 256 bits de estado via SplitMix64)
+         */
+        explicit Xoshiro256StarStar(std::uint64_t seed = 0) noexcept;
+
+        /**
+         * @brief Reinicia o estado a partir de uma semente
+         * @param seed Nova semente
+         */
+        void seed(std::uint64_t seed) noexcept;
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+        /**
+         * @brief Próximo valor de 64 bits
+         */
+        result_type operator()() noexcept
+        {
+            const std::uint64_t result = std::rotl(state_[1] * 5, 7) * 9;
+            const std::uint64_t t = state_[1] << 17;
+
+            state_[2] ^= state_[0];
+            state_[3] ^= state_[1];
+            state_[1] ^= state_[2];
+            state_[0] ^= state_[3];
+            state_[2] ^= t;
+            state_[3] = std::rotl(state_[3], 45);
+
+            return result;
+        }
+
+    private:
+        std::array<std::uint64_t, 4> state_; ///< Estado de 256 bits
+    };
+
+    /**
+     * @class Pcg32
+     * @brief Gerador PCG32 XSH-RR (O'Neill): LCG de 64 bits, saída de 32 bits
+     *
+     * O incremento do LCG seleciona um de 2^63 fluxos independentes.
+     */
+    class Pcg32
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        /**
+         * @brief Construtor
+         * @param seed Semente (posição inicial)
+         * @param stream Identificador do fluxo
+         */
+        explicit Pcg32(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept;
+
+        /**
+         * @brief Reinicia o estado a partir de uma semente e de um fluxo
+         * @param seed Nova semente
+         * @param stream Identificador do fluxo
+         */
+        void seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept;
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+        /**
+         * @brief Próximo valor de 32 bits
+         */
+        result_type operator()() noexcept
+        {
+            const std::uint64_t old = state_;
+            state_ = old * MULTIPLIER + increment_;
+            const auto xorshifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+            const auto rot = static_cast<int>(old >> 59);
+            return std::rotr(xorshifted, rot);
+        }
+
+    private:
+        static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ull;
+
+        std::uint64_t state_;     ///< Estado do LCG
+        std::uint64_t increment_; ///< Incremento (ímpar) do LCG: define o fluxo
+    };
+
+    /**
+     * @brief Próximos 32 bits aleatórios de um gerador de 32 ou 64 bits
+     */
+    template <typename Engine>
+    [[nodiscard]] inline std::uint32_t next32(Engine &engine) noexcept
+    {
+        if constexpr (Engine::max() > 0xFFFFFFFFull)
+        {
+            return static_cast<std::uint32_t>(engine() >> 32); // bits altos: melhor qualidade
+        }
+        else
+        {
+            return static_cast<std::uint32_t>(engine());
+        }
+    }
+
+    /**
+     * @brief Inteiro uniforme em [0, range) sem viés
+     *
+     * Método de Lemire (multiplicação 32x32→64 com rejeição): na maioria das
+     * chamadas não há divisão; o resto só é calculado quando a parte baixa do
+     * produto cai na faixa que introduziria viés.
+     *
+     * @param engine Gerador com saída de 32 ou 64 bits cobrindo todo o intervalo
+     * @param range Tamanho do intervalo (> 0)
+     * @return Valor em [0, range)
+     */
+    template <typename Engine>
+    [[nodiscard]] inline std::uint32_t bounded(Engine &engine, std::uint32_t range) noexcept
+    {
+        std::uint64_t product = static_cast<std::uint64_t>(next32(engine)) * range;
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < range)
+        {
+            const std::uint32_t threshold = (0u - range) % range;
+            while (low < threshold)
+            {
+                product = static_cast<std::uint64_t>(next32(engine)) * range;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    /**
+     * @brief Nome legível de um gerador
+     * @param engine Gerador
+     * @return Nome ("Xoshiro256**", "PCG32", "MT19937")
+     */
+    [[nodiscard]] std::string_view engineName(RngEngine engine) noexcept;
+} // namespace prng
+
+#endif // RANDOM_ENGINE_H
@@ -0,0 +1,66 @@
+/**
+ * @file sorting.cpp
+ * @brief Implementação dos utilitários de ordenação
+ */
+
+#include "sorting.h"
+
+#include <array>
+#include <cstddef>
+
+namespace sorting
+{
+    void radixSortHigh32(std::vector<std::uint64_t> &values)
+    {
+        constexpr int RADIX_BITS = 8;
+        constexpr std::size_t BUCKETS = std::size_t{1} << RADIX_BITS;
+        constexpr int PASSES = 32 / RADIX_BITS;
+
+        const std::size_t n = values.size();
+        if (n < 2)
+        {
+            return;
+        }
+
+        // Histogramas de todas as passadas em uma única leitura
+        std::array<std::array<std::size_t, BUCKETS>, PASSES> counts{};
+        for (const std::uint64_t v : values)
+        {
+            for (int pass = 0; pass < PASSES; ++pass)
+            {
+                const auto digit = static_cast<std::size_t>((v >> (32 + pass * RADIX_BITS)) & (BUCKETS - 1));
+                ++counts[static_cast<std::size_t>(pass)][digit];
+            }
+        }
+
+        std::vector<std::uint64_t> buffer(n);
+        for (int pass = 0; pass < PASSES; ++pass)
+        {
+            auto &count = counts[static_cast<std::size_t>(pass)];
+            const int shift = 32 + pass * RADIX_BITS;
+
+            // Todos com o mesmo dígito: passada não altera a ordem
+            const auto first_digit = static_cast<std::size_t>((values[0] >> shift) & (BUCKETS - 1));
+            if (count[first_digit] == n)
+            {
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (auto &c : count)
+            {
+                const std::size_t bucket_size = c;
+                c = offset;
+                offset += bucket_size;
+            }
+
+            for (const std::uint64_t v : values)
+            {
+                const auto digit = static_cast<std::size_t>((v >> shift) & (BUCKETS - 1));
+                buffer[count[digit]++] = v;
+            }
+            values.swap(buffer);
+        }
+    }
+
+} // namespace sorting
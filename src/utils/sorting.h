@@ -0,0 +1,57 @@
+/**
+ * @file sorting.h
+ * @brief Utilitários de ordenação de itens por chave inteira
+ *
+ * Itens com chave inteira são empacotados em um uint64 (chave invertida nos
+ * 32 bits altos, índice nos 32 bits baixos). A ordem crescente do valor
+ * empacotado equivale a "maior chave primeiro, menor índice no empate".
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef SORTING_H
+#define SORTING_H
+
+#include <cstdint>
+#include <vector>
+
+namespace sorting
+{
+    /**
+     * @brief Empacota (chave, item) para ordenação decrescente por chave
+     * @param key Chave inteira (maior = mais prioritário)
+     * @param item Índice do item (base 0, não negativo)
+     * @return Valor empacotado
+     */
+    [[nodiscard]] constexpr std::uint64_t packDescending(int key, int item) noexcept
+    {
+        const auto flipped = static_cast<std::uint32_t>(~(static_cast<std::uint32_t>(key) ^ 0x80000000u));
+        return (static_cast<std::uint64_t>(flipped) << 32) | static_cast<std::uint32_t>(item);
+    }
+
+    /**
+     * @brief Extrai o índice do item de um valor empacotado
+     * @param packed Valor gerado por packDescending
+     * @return Índice do item
+     */
+    [[nodiscard]] constexpr int unpackItem(std::uint64_t packed) noexcept
+    {
+        return static_cast<int>(packed & 0xFFFFFFFFu);
+    }
+
+    /**
+     * @brief LSD radix sort estável pelos 32 bits altos
+     *
+     * Quatro passadas de 8 bits; passadas em que todos os valores têm o
+     * mesmo dígito são puladas. Como a ordenação é estável, entradas geradas
+     * em ordem crescente de índice terminam com empates por menor índice.
+     *
+     * @param values Valores empacotados (ordenados in-place)
+     * @note Complexidade: O(n) com no máximo 4 passadas
+     */
+    void radixSortHigh32(std::vector<std::uint64_t> &values);
+
+} // namespace sorting
+
+#endif // SORTING_H
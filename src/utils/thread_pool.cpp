@@ -0,0 +1,65 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Implementação da classe ThreadPool
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int n_threads)
+    : stopping_(false)
+{
+    const unsigned int count = (n_threads == 0) ? defaultThreadCount() : n_threads;
+    workers_.reserve(count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        workers_.emplace_back([this]
+                              { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+
+    // Join explícito: a fila e o mutex precisam sobreviver às threads
+    workers_.clear();
+}
+
+unsigned int ThreadPool::size() const noexcept
+{
+    return static_cast<unsigned int>(workers_.size());
+}
+
+unsigned int ThreadPool::defaultThreadCount() noexcept
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this]
+                     { return stopping_ || !tasks_.empty(); });
+
+            if (tasks_.empty())
+            {
+                // stopping_ e fila vazia
+                return;
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file thread_pool.h
+ * @brief Pool de threads de tamanho fixo para execução de tarefas
+ *
+ * Pool simples com fila FIFO compartilhada. As tarefas são submetidas via
+ * submit() e o resultado é obtido por std::future, permitindo que o chamador
+ * colete os resultados na ordem que desejar (determinística).
+ *
+ * @author Thalles e Luiz
+ * @version 2.0
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Executa tarefas em um conjunto fixo de threads trabalhadoras
+ *
+ * @note O destrutor aguarda a conclusão de todas as tarefas já submetidas.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Construtor
+     * @param n_threads Número de threads (0 → defaultThreadCount())
+     */
+    explicit ThreadPool(unsigned int n_threads = 0);
+
+    /**
+     * @brief Destrutor: esvazia a fila e encerra as threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Submete uma tarefa para execução assíncrona
+     * @param task Callable sem argumentos
+     * @return Future com o resultado da tarefa
+     */
+    template <typename F>
+    [[nodiscard]] std::future<std::invoke_result_t<F>> submit(F &&task)
+    {
+        using Result = std::invoke_result_t<F>;
+
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packaged->get_future();
+        {
+            const std::lock_guard lock(mutex_);
+            tasks_.emplace_back([packaged]
+                                { (*packaged)(); });
+        }
+        cv_.notify_one();
+        return future;
+    }
+
+    /**
+     * @brief Retorna o número de threads do pool
+     * @return Número de threads trabalhadoras
+     */
+    [[nodiscard]] unsigned int size() const noexcept;
+
+    /**
+     * @brief Número de threads padrão (núcleos disponíveis, mínimo 1)
+     * @return Número de threads de hardware
+     */
+    [[nodiscard]] static unsigned int defaultThreadCount() noexcept;
+
+private:
+    std::vector<std::jthread> workers_;        ///< Threads trabalhadoras
+    std::deque<std::function<void()>> tasks_;  ///< Fila de tarefas pendentes
+    std::mutex mutex_;                         ///< Protege a fila
+    std::condition_variable cv_;               ///< Sinaliza novas tarefas
+    bool stopping_;                            ///< Indica encerramento do pool
+
+    /**
+     * @brief Laço principal de cada thread trabalhadora
+     */
+    void workerLoop();
+};
+
+#endif // THREAD_POOL_H